@@ -3,6 +3,7 @@
 
 
 #include "../chaos/effect.h"
+#include "../../arena.h"
 #include "../../menu.h"
 #include "../../settings.h"
 #include "../../string_utils.h"
@@ -447,7 +448,7 @@ static void OnRender(IDirect3DDevice9* device)
     }
 }
 
-static bool IsUISceneOpened(const std::vector<std::string>& names)
+static bool IsUISceneOpened(std::initializer_list<std::string_view> names)
 {
     const auto viewport = Engine::GetViewportClient();
     if (!viewport || !viewport->UIController)
@@ -469,11 +470,14 @@ static bool IsUISceneOpened(const std::vector<std::string>& names)
             continue;
         }
 
-        const auto currentSceneName = currentScene->GetObjectName();
+        // Same as GetObjectName, without leaving the frame arena
+        const auto fullName = Arena::GetName(currentScene->Name);
+        const auto suffix = fullName.find_last_of('_');
+        const auto currentSceneName = std::string_view(fullName.c_str(), suffix != Arena::String::npos ? suffix : fullName.size());
 
-        for (size_t j = 0; j < names.size(); j++)
+        for (const auto& name : names)
         {
-            if (currentSceneName == names[j])
+            if (currentSceneName == name)
             {
                 return true;
             }
@@ -554,13 +558,13 @@ static void OnTick(float deltaTime)
         return;
     }
 
-    std::vector<std::string> activeEffectClasses;
+    Arena::Vector<std::string> activeEffectClasses;
     for (const auto& activeEffect : ActiveEffects)
     {
         activeEffectClasses.push_back(activeEffect.Effect->GetClass());
     }
 
-    std::vector<Effect*> effectPool;
+    Arena::Vector<Effect*> effectPool;
     for (const auto& enabledEffect : EnabledEffects)
     {
         bool addToPool = true;
@@ -1,4 +1,5 @@
 #include "effect.h"
+#include "../../arena.h"
 #include <stack>
 
 std::vector<Effect*>& Effects()
@@ -126,7 +127,7 @@ std::vector<Classes::USequenceObject*> Effect::GetKismetSequenceObjects(const st
             continue;
         }
 
-        if (level->PackageName.GetName() != levelName)
+        if (Arena::GetName(level->PackageName).c_str() != levelName)
         {
             continue;
         }
@@ -153,7 +154,7 @@ bool Effect::IsSubLevelLoaded(const std::string& levelName)
             continue;
         }
 
-        if (level->PackageName.GetName() == levelName)
+        if (Arena::GetName(level->PackageName).c_str() == levelName)
         {
             return true;
         }
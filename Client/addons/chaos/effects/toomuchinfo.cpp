@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../effect.h"
+#include "../../../arena.h"
 #include <map>
 
 class TooMuchInfo : public Effect
@@ -103,7 +104,7 @@ private:
         }
 
         const auto controller = Engine::GetPlayerController();
-        const auto cameraStyle = camera->CameraStyle.GetName();
+        const auto cameraStyle = Arena::GetName(camera->CameraStyle);
 
         ImGui::Text("CameraStyle: %s", cameraStyle.empty() ? "n/a" : cameraStyle.c_str());
         ImGui::Text("bLockedFOV: %d", camera->bLockedFOV);
@@ -148,7 +149,7 @@ private:
             return;
         }
 
-        ImGui::Text("Name: %s", weapon->Name.GetName().c_str());
+        ImGui::Text("Name: %s", Arena::GetName(weapon->Name).c_str());
         ImGui::Text("EquipTime: %.2f", weapon->EquipTime);
         ImGui::Text("PutDownTime: %.2f", weapon->PutDownTime);
         ImGui::Text("WeaponRange: %.0f", weapon->WeaponRange);
@@ -223,7 +224,7 @@ private:
 
         for (size_t i = 0; i < input->PressedKeys.Num(); i++)
         {
-            ImGui::Text("[%d] %s", i, input->PressedKeys[i].GetName().c_str());
+            ImGui::Text("[%d] %s", i, Arena::GetName(input->PressedKeys[i]).c_str());
         }
 
         WindowEnd();
@@ -3,21 +3,27 @@
 #define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
 #endif
 
+#include <atomic>
 #include <codecvt>
 #include <locale>
 #include <mutex>
 #include <shared_mutex>
+#include <unordered_set>
 #include <vector>
 
 #include <WS2tcpip.h>
 #include <WinSock2.h>
 #pragma comment(lib, "ws2_32.lib")
 
+#include "../arena.h"
 #include "../engine.h"
 #include "../imgui/imgui.h"
+#include "../intern.h"
 #include "../json.h"
 #include "../menu.h"
+#include "../queue.h"
 #include "../settings.h"
+#include "../trace.h"
 
 #include "client.h"
 
@@ -44,41 +50,289 @@ static sockaddr_in Server = {0};
 static SOCKET TCPSocket = 0;
 static SOCKET UDPSocket = 0;
 
+static const auto MaxChatMessages = 100;
+
+struct ChatMessage
+{
+    char Text[0x200];
+};
+
+// A message in the chat history. Height is the wrapped text height at
+// WrapWidth and is only measured again when the overlay width changes
+struct ChatLine
+{
+    char Text[0x200];
+    int Length;
+    float WrapWidth;
+    float Height;
+};
+
 static struct 
 {
     bool Focused = false;
     bool ShowOverlay = true;
     int Keybind = 0;
-    std::string Raw;
     unsigned long long LastTime = 0ULL;
-    std::mutex Mutex;
+
+    // Pushed by any thread, drained into Lines by the render thread
+    BoundedQueue<ChatMessage, 64> Incoming;
+
+    // Takes the messages of a burst the queue can't hold. Once it's used, later
+    // messages queue behind it until the render thread drains it, to keep them
+    // in order
+    std::mutex OverflowMutex;
+    std::vector<ChatMessage> Overflow;
+    std::atomic<bool> Overflowed{false};
+
+    // Ring of the most recent messages, oldest at Head
+    ChatLine Lines[MaxChatMessages];
+    int Head = 0;
+    int Count = 0;
+
+    // Whole history as one string for the client tab, rebuilt when messages arrive
+    std::string Log;
 } Chat;
 
 static Client::Player UserClient = {0};
 
+static const auto MainMenuLevel = Intern::Get(Map_MainMenu);
+
+// Stands in for level names the server sent that weren't interned. Never a
+// real level name, so it doesn't match the user's level
+static const auto UnknownLevel = Intern::Get("?");
+
+static const char *KnownLevels[] = {
+    Map_MainMenu, Map_Prologue, Map_Flight, Map_Jacknife, Map_Heat, Map_Ropeburn,
+    Map_NewEden, Map_Factory, Map_TheBoat, Map_Kate, Map_TheShard,
+};
+
+// Upper bound on level names interned from server messages, interned strings
+// are never freed
+static const auto MaxServerLevels = 256;
+
+// Logs a level name GetServerLevel turned down, once per name
+static Intern::Id RejectServerLevel(const std::string &level, const char *reason) 
+{
+    static std::unordered_set<std::string> logged;
+
+    if (logged.size() < MaxServerLevels && logged.insert(level).second) 
+    {
+        printf("client: not interning server level \"%.64s\", %s\n", level.c_str(), reason);
+    }
+
+    return UnknownLevel;
+}
+
+// Interns a level name from a server message. Known maps and levels the user
+// has loaded are always accepted. Anything else must look like a package name,
+// and only MaxServerLevels of those are interned, so a server can't grow the
+// table without bound. ClientListener only
+static Intern::Id GetServerLevel(const std::string &level) 
+{
+    static auto interned = 0;
+
+    const auto id = Intern::Find(level);
+    if (id != 0) 
+    {
+        return id;
+    }
+
+    for (const auto known : KnownLevels) 
+    {
+        if (level == known) 
+        {
+            return Intern::Get(level);
+        }
+    }
+
+    if (level.empty() || level.size() > 64) 
+    {
+        return RejectServerLevel(level, "bad length");
+    }
+
+    if (interned == MaxServerLevels) 
+    {
+        return RejectServerLevel(level, "too many levels");
+    }
+
+    for (const auto c : level) 
+    {
+        if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '-')) 
+        {
+            return RejectServerLevel(level, "not a package name");
+        }
+    }
+
+    ++interned;
+    return Intern::Get(level);
+}
+
+enum class MessageType 
+{
+    Unknown,
+    Connect,
+    Name,
+    Chat,
+    Announce,
+    Level,
+    Character,
+    Ping,
+    Disconnect,
+    GameMode,
+    CanTag,
+    Tagged
+};
+
+// Server messages and game modes are parsed once when they arrive, handlers switch on the result
+static MessageType GetMessageType(const std::string &type) 
+{
+    static const std::pair<const char *, MessageType> types[] = {
+        {"connect", MessageType::Connect},
+        {"name", MessageType::Name},
+        {"chat", MessageType::Chat},
+        {"announce", MessageType::Announce},
+        {"level", MessageType::Level},
+        {"character", MessageType::Character},
+        {"ping", MessageType::Ping},
+        {"disconnect", MessageType::Disconnect},
+        {"gameMode", MessageType::GameMode},
+        {"canTag", MessageType::CanTag},
+        {"tagged", MessageType::Tagged},
+    };
+
+    for (const auto &entry : types) 
+    {
+        if (type == entry.first) 
+        {
+            return entry.second;
+        }
+    }
+
+    return MessageType::Unknown;
+}
+
+static Client::GameModeType GetGameMode(const std::string &gameMode) 
+{
+    if (gameMode == GameMode_None) 
+    {
+        return Client::GameModeType::None;
+    }
+
+    if (gameMode == GameMode_Tag) 
+    {
+        return Client::GameModeType::Tag;
+    }
+
+    return Client::GameModeType::Unknown;
+}
+
+static const auto MaxPlayers = 64;
+
+// Remote players, one slot per player across parallel arrays so the per tick and
+// per frame loops only touch the fields they read. A slot keeps its index while
+// the player is connected, queued spawns write to its Actor by address
 static struct 
 {
     bool ShowNameTags = true;
-    std::vector<Client::Player *> List;
     std::shared_mutex Mutex;
+
+    // Slots below Slots have been used, Active marks the connected ones
+    int Slots = 0;
+    int Count = 0;
+
+    // Hot fields
+    bool Active[MaxPlayers] = {false};
+    bool Received[MaxPlayers] = {false};
+    bool Spawning[MaxPlayers] = {false};
+    unsigned int Id[MaxPlayers] = {0};
+    Intern::Id LevelId[MaxPlayers] = {0};
+    Classes::ASkeletalMeshActorSpawnable *Actor[MaxPlayers] = {nullptr};
+    Classes::FVector Position[MaxPlayers];
+    unsigned short Yaw[MaxPlayers] = {0};
+    float MaxZ[MaxPlayers] = {0};
+    Engine::Character Character[MaxPlayers];
+
+    // The actor whose mesh is subscribed to the bones tick, once per spawn
+    Classes::ASkeletalMeshActorSpawnable *Subscribed[MaxPlayers] = {nullptr};
+
+    // Cold fields
+    std::string Name[MaxPlayers];
+
+    // The level name as the server sent it, shown when LevelId is UnknownLevel
+    std::string LevelName[MaxPlayers];
+
+    // Latest pose of each player, written by the packet handler
+    alignas(16) Classes::FBoneAtom Bones[MaxPlayers][PLAYER_PAWN_BONE_COUNT];
 } Players;
 
-static Client::Player *GetPlayerById(unsigned int id) 
+// Returns the slot of a connected player, or -1
+static int FindPlayer(unsigned int id) 
 {
-    for (const auto &p : Players.List) 
+    for (auto i = 0; i < Players.Slots; ++i) 
     {
-        if (p->Id == id) 
+        if (Players.Active[i] && Players.Id[i] == id) 
         {
-            return p;
+            return i;
         }
     }
 
-    return nullptr;
+    return -1;
 }
 
-std::vector<Client::Player *> Client::GetPlayerList() 
-{ 
-    return Players.List; 
+// Claims a free slot, skipping slots whose actor is still being spawned.
+// Requires the exclusive lock
+static int AddPlayer() 
+{
+    auto slot = -1;
+    for (auto i = 0; i < Players.Slots && slot < 0; ++i) 
+    {
+        if (!Players.Active[i] && !Players.Actor[i] && !Players.Spawning[i]) 
+        {
+            slot = i;
+        }
+    }
+
+    if (slot < 0) 
+    {
+        if (Players.Slots == MaxPlayers) 
+        {
+            return -1;
+        }
+
+        slot = Players.Slots++;
+    }
+
+    Players.Active[slot] = true;
+    Players.Received[slot] = false;
+    ++Players.Count;
+
+    return slot;
+}
+
+// Queues the slot's actor. The engine writes it by address once spawned and
+// clears Spawning afterwards, also when the spawn failed, so the slot isn't
+// handed to another player while the spawn is in flight
+static void SpawnPlayer(int slot) 
+{
+    Players.Subscribed[slot] = nullptr;
+    Engine::SpawnCharacter(Players.Character[slot], Players.Actor[slot], &Players.Spawning[slot]);
+}
+
+// Releases a slot and despawns its actor. Requires the exclusive lock
+static void RemovePlayer(int slot) 
+{
+    if (Players.Actor[slot]) 
+    {
+        Engine::Despawn(Players.Actor[slot]);
+        Players.Actor[slot] = nullptr;
+    }
+
+    Players.Active[slot] = false;
+    Players.Received[slot] = false;
+    Players.Name[slot].clear();
+    Players.LevelName[slot].clear();
+    Players.LevelId[slot] = 0;
+    --Players.Count;
 }
 
 static void IgnorePlayerInput(bool ignoreInput) 
@@ -192,27 +446,98 @@ static bool SendJsonMessage(json msg)
 
 static void AddChatMessage(std::string message) 
 {
-    static const auto maxMessages = 100;
-
     SYSTEMTIME time;
     GetLocalTime(&time);
 
-    char formattedTime[0xFF];
-    sprintf_s(formattedTime, sizeof(formattedTime), "%d:%02d: ", time.wHour, time.wMinute);
+    ChatMessage formatted;
+    if (_snprintf_s(formatted.Text, _TRUNCATE, "%d:%02d: %s", time.wHour, time.wMinute, message.c_str()) < 0) 
+    {
+        // Marks the cut, stepping back to the start of a UTF-8 character
+        auto end = sizeof(formatted.Text) - sizeof("...");
+        while (end > 0 && (static_cast<unsigned char>(formatted.Text[end]) & 0xC0) == 0x80) 
+        {
+            --end;
+        }
+
+        memcpy(formatted.Text + end, "...", sizeof("..."));
+    }
 
-    const auto formattedMsg = formattedTime + message + "\n";
+    if (!Chat.Overflowed.load(std::memory_order_acquire) && Chat.Incoming.Push([&](ChatMessage &entry) { entry = formatted; })) 
+    {
+        return;
+    }
 
-    Chat.Mutex.lock();
+    std::lock_guard<std::mutex> lock(Chat.OverflowMutex);
+    Chat.Overflow.push_back(formatted);
+    Chat.Overflowed.store(true, std::memory_order_release);
+}
+
+// Moves pending messages into the history ring. Only called from the render thread
+static void DrainChatMessages() 
+{
+    auto received = false;
+
+    const auto append = [&](ChatMessage &message) 
+    {
+        auto &line = Chat.Lines[(Chat.Head + Chat.Count) % MaxChatMessages];
+        if (Chat.Count == MaxChatMessages) 
+        {
+            Chat.Head = (Chat.Head + 1) % MaxChatMessages;
+        } 
+        else 
+        {
+            ++Chat.Count;
+        }
+
+        memcpy(line.Text, message.Text, sizeof(line.Text));
+        line.Length = static_cast<int>(strlen(line.Text));
+        line.WrapWidth = 0.0f;
+        line.Height = 0.0f;
+
+        received = true;
+    };
+
+    while (Chat.Incoming.Pop(append)) 
+    {
+    }
+
+    if (Chat.Overflowed.load(std::memory_order_acquire)) 
+    {
+        std::lock_guard<std::mutex> lock(Chat.OverflowMutex);
+
+        // Anything still queued was pushed before the overflow began
+        while (Chat.Incoming.Pop(append)) 
+        {
+        }
+
+        for (auto &message : Chat.Overflow) 
+        {
+            append(message);
+        }
+
+        Chat.Overflow.clear();
+        Chat.Overflowed.store(false, std::memory_order_release);
+    }
+
+    if (!received) 
+    {
+        return;
+    }
 
-    Chat.Raw += formattedMsg;
     Chat.LastTime = GetTickCount64();
 
-    if (std::count(Chat.Raw.begin(), Chat.Raw.end(), '\n') > maxMessages) 
+    Chat.Log.clear();
+    for (auto i = 0; i < Chat.Count; ++i) 
     {
-        Chat.Raw.erase(0, Chat.Raw.find('\n') + 1);
+        const auto &line = Chat.Lines[(Chat.Head + i) % MaxChatMessages];
+        Chat.Log.append(line.Text, line.Length);
+        Chat.Log += '\n';
     }
+}
 
-    Chat.Mutex.unlock();
+static ChatLine &GetChatLine(int index) 
+{
+    return Chat.Lines[(Chat.Head + index) % MaxChatMessages];
 }
 
 static void SendChatInput() 
@@ -264,18 +589,13 @@ static void Disconnect()
     }
 
     Players.Mutex.lock();
-    for (const auto &p : Players.List) 
+    for (auto i = 0; i < Players.Slots; ++i) 
     {
-        if (p->Actor) 
+        if (Players.Active[i]) 
         {
-            Engine::Despawn(p->Actor);
+            RemovePlayer(i);
         }
-
-        delete p;
     }
-
-    Players.List.clear();
-    Players.List.shrink_to_fit();
     Players.Mutex.unlock();
 
     IsConnected = false;
@@ -283,6 +603,8 @@ static void Disconnect()
 
 static void PlayerHandler() 
 {
+    Trace::NameThread("PlayerHandler");
+
     while (IsConnected) 
     {
         Client::PACKET_COMPRESSED packet;
@@ -293,14 +615,18 @@ static void PlayerHandler()
             continue;
         }
 
+        Trace::Span span("PlayerPacket");
+
         Players.Mutex.lock_shared();
 
-        const auto player = GetPlayerById(packet.Id);
-        if (player) 
+        const auto slot = FindPlayer(packet.Id);
+        if (slot >= 0) 
         {
-            memcpy(&player->LastPacket, &packet, FIELD_OFFSET(Client::PACKET_COMPRESSED, CompressedBones));
+            Players.Position[slot] = packet.Position;
+            Players.Yaw[slot] = packet.Yaw;
+            Players.Received[slot] = true;
 
-            const auto bonesBase = reinterpret_cast<byte *>(player->LastPacket.Bones);
+            const auto bonesBase = reinterpret_cast<byte *>(Players.Bones[slot]);
             for (auto i = 0; i < ARRAYSIZE(CompressedBoneOffsets); ++i) 
             {
                 *reinterpret_cast<float *>(bonesBase + CompressedBoneOffsets[i]) = static_cast<float>(packet.CompressedBones[i]) / 215.f;
@@ -323,9 +649,10 @@ static bool Join()
         }
 
         UserClient.Level = GetLowercasedLevelName(world->GetMapName(false).c_str());
+        UserClient.LevelId = Intern::Get(UserClient.Level);
         
 
-        if (UserClient.Level == Map_MainMenu) 
+        if (UserClient.LevelId == MainMenuLevel) 
         {
             IsLoading = true;
         }
@@ -363,7 +690,7 @@ static bool Join()
     }
 
     UserClient.Id = msgId;
-    UserClient.GameMode = msgGameMode.get<std::string>();
+    UserClient.GameMode = GetGameMode(msgGameMode.get<std::string>());
     UserClient.TaggedPlayerId = PreviousTaggedId = msgTaggedPlayerId;
     UserClient.CanTag = msgCanTag;
 
@@ -373,6 +700,8 @@ static bool Join()
 
 static void ClientListener() 
 {
+    Trace::NameThread("ClientListener");
+
     for (;; Disconnect(), Sleep(500)) 
     {
         if (IsMultiplayerDisabled) 
@@ -440,13 +769,17 @@ static void ClientListener()
         json msg;
         while (RecvJsonMessage(msg)) 
         {
+            Trace::Span span("ServerMessage");
+
             auto msgType = msg["type"];
             if (!msgType.is_string()) 
             {
                 continue;
             }
 
-            if (msgType == "connect") 
+            switch (GetMessageType(msgType.get<std::string>())) 
+            {
+            case MessageType::Connect: 
             {
                 const auto msgId = msg["id"];
                 const auto msgName = msg["name"];
@@ -460,12 +793,22 @@ static void ClientListener()
 
                 Players.Mutex.lock();
 
-                const auto player = new Client::Player();
-                player->Id = msgId;
-                player->Name = msgName.get<std::string>();
-                player->Character = msgCharacter;
-                player->Level = msgLevel.get<std::string>();
-                player->LastPacket = {0};
+                const auto slot = AddPlayer();
+                if (slot < 0) 
+                {
+                    Players.Mutex.unlock();
+
+                    printf("client: room is over %d players, ignoring %x\n", MaxPlayers, msgId.get<unsigned int>());
+                    AddChatMessage(msgName.get<std::string>() + " joined but isn't shown, the room is over " + std::to_string(MaxPlayers) + " players");
+                    continue;
+                }
+
+                Players.Id[slot] = msgId;
+                Players.Name[slot] = msgName.get<std::string>();
+                Players.Character[slot] = msgCharacter;
+                Players.LevelName[slot] = msgLevel.get<std::string>();
+                Players.LevelId[slot] = GetServerLevel(Players.LevelName[slot]);
+                Players.MaxZ[slot] = 0;
 
                 static const unsigned long defaultBones[] = {
                     0x0,        0x0,        0x0,        0x3f800000, 0x0,
@@ -642,23 +985,20 @@ static void ClientListener()
                     0x3f7fffff, 0x3a049678, 0x3d3ec44a, 0x3bb2a169, 0x3f7fb7e6,
                     0x0,        0x37800000, 0xb5800000, 0x3f7fffff};
 
-                memcpy(player->LastPacket.Bones, defaultBones, sizeof(defaultBones));
+                memcpy(Players.Bones[slot], defaultBones, sizeof(defaultBones));
 
-                if (player->Level == UserClient.Level && !IsLoading) 
-                {
-                    Engine::SpawnCharacter(player->Character, player->Actor);
-                } 
-                else 
+                if (Players.LevelId[slot] == UserClient.LevelId && !IsLoading) 
                 {
-                    player->Actor = nullptr;
+                    SpawnPlayer(slot);
                 }
 
-                AddChatMessage(player->Name + " joined the room");
+                AddChatMessage(Players.Name[slot] + " joined the room");
 
-                Players.List.push_back(player);
                 Players.Mutex.unlock();
-            } 
-            else if (msgType == "name") 
+                break;
+            }
+
+            case MessageType::Name: 
             {
                 const auto msgId = msg["id"];
                 const auto msgName = msg["name"];
@@ -670,17 +1010,20 @@ static void ClientListener()
 
                 Players.Mutex.lock_shared();
 
-                const auto player = GetPlayerById(msgId);
-                if (player) 
+                const auto slot = FindPlayer(msgId);
+                if (slot >= 0) 
                 {
                     auto newName = msgName.get<std::string>();
-                    AddChatMessage(player->Name + " renamed to " + newName);
-                    player->Name = newName;
+                    AddChatMessage(Players.Name[slot] + " renamed to " + newName);
+                    Players.Name[slot] = newName;
                 }
 
                 Players.Mutex.unlock_shared();
-            } 
-            else if (msgType == "chat" || msgType == "announce") 
+                break;
+            }
+
+            case MessageType::Chat: 
+            case MessageType::Announce: 
             {
                 const auto msgBody = msg["body"];
                 if (!msgBody.is_string()) 
@@ -691,8 +1034,10 @@ static void ClientListener()
                 Players.Mutex.lock_shared();
                 AddChatMessage(msgBody.get<std::string>());
                 Players.Mutex.unlock_shared();
-            } 
-            else if (msgType == "level") 
+                break;
+            }
+
+            case MessageType::Level: 
             {
                 const auto msgId = msg["id"];
                 const auto msgLevel = msg["level"];
@@ -702,33 +1047,37 @@ static void ClientListener()
                     continue;
                 }
 
-                Players.Mutex.lock_shared();
+                // Exclusive, the tab reads LevelName
+                Players.Mutex.lock();
 
-                const auto player = GetPlayerById(msgId);
-                if (player) 
+                const auto slot = FindPlayer(msgId);
+                if (slot >= 0) 
                 {
-                    player->Level = msgLevel.get<std::string>();
+                    Players.LevelName[slot] = msgLevel.get<std::string>();
+                    Players.LevelId[slot] = GetServerLevel(Players.LevelName[slot]);
 
-                    if (player->Level == UserClient.Level) 
+                    if (Players.LevelId[slot] == UserClient.LevelId) 
                     {
-                        if (!player->Actor && !IsLoading) 
+                        if (!Players.Actor[slot] && !IsLoading) 
                         {
-                            Engine::SpawnCharacter(player->Character, player->Actor);
+                            SpawnPlayer(slot);
                         }
                     } 
                     else 
                     {
-                        if (player->Actor) 
+                        if (Players.Actor[slot]) 
                         {
-                            Engine::Despawn(player->Actor);
-                            player->Actor = nullptr;
+                            Engine::Despawn(Players.Actor[slot]);
+                            Players.Actor[slot] = nullptr;
                         }
                     }
                 }
 
-                Players.Mutex.unlock_shared();
-            } 
-            else if (msgType == "character") 
+                Players.Mutex.unlock();
+                break;
+            }
+
+            case MessageType::Character: 
             {
                 const auto msgId = msg["id"];
                 const auto msgCharacter = msg["character"];
@@ -740,26 +1089,28 @@ static void ClientListener()
 
                 Players.Mutex.lock_shared();
 
-                const auto player = GetPlayerById(msgId);
-                if (player) 
+                const auto slot = FindPlayer(msgId);
+                if (slot >= 0) 
                 {
-                    player->Character = msgCharacter;
+                    Players.Character[slot] = msgCharacter;
 
                     if (!IsLoading) 
                     {
-                        if (player->Actor) 
+                        if (Players.Actor[slot]) 
                         {
-                            Engine::Despawn(player->Actor);
-                            player->Actor = nullptr;
+                            Engine::Despawn(Players.Actor[slot]);
+                            Players.Actor[slot] = nullptr;
                         }
 
-                        Engine::SpawnCharacter(player->Character, player->Actor);
+                        SpawnPlayer(slot);
                     }
                 }
 
                 Players.Mutex.unlock_shared();
-            } 
-            else if (msgType == "ping") 
+                break;
+            }
+
+            case MessageType::Ping: 
             {
                 if (SendJsonMessage({
                         {"type", "pong"},
@@ -768,8 +1119,10 @@ static void ClientListener()
                 {
                     lastPing = GetTickCount64();
                 }
-            } 
-            else if (msgType == "disconnect") 
+                break;
+            }
+
+            case MessageType::Disconnect: 
             {
                 const auto msgId = msg["id"];
                 if (!msgId.is_number_integer()) 
@@ -778,27 +1131,19 @@ static void ClientListener()
                 }
 
                 Players.Mutex.lock();
-                Players.List.erase(std::remove_if(Players.List.begin(), Players.List.end(),[&msgId](Client::Player *p) 
-                {
-                    if (p->Id != msgId) 
-                    {
-                        return false;
-                    }
 
-                    if (p->Actor) 
-                    {
-                        Engine::Despawn(p->Actor);
-                        p->Actor = nullptr;
-                    }
-
-                    AddChatMessage(p->Name + " left the room");
+                const auto slot = FindPlayer(msgId);
+                if (slot >= 0) 
+                {
+                    AddChatMessage(Players.Name[slot] + " left the room");
+                    RemovePlayer(slot);
+                }
 
-                    delete p;
-                    return true;
-                }));
                 Players.Mutex.unlock();
+                break;
             }
-            else if (msgType == "gameMode") 
+
+            case MessageType::GameMode: 
             {
                 const auto msgGameMode = msg["gameMode"];
 
@@ -814,9 +1159,11 @@ static void ClientListener()
 
                 UserClient.CanTag = false;
                 UserClient.TaggedPlayerId = 0;
-                UserClient.GameMode = msgGameMode.get<std::string>();
-            } 
-            else if (msgType == "canTag") 
+                UserClient.GameMode = GetGameMode(msgGameMode.get<std::string>());
+                break;
+            }
+
+            case MessageType::CanTag: 
             {
                 TaggedTimed = 0;
                 UserClient.CanTag = true;
@@ -825,8 +1172,10 @@ static void ClientListener()
                 {
                     IgnorePlayerInput(false);
                 }
-            } 
-            else if (msgType == "tagged") 
+                break;
+            }
+
+            case MessageType::Tagged: 
             {
                 const auto msgTaggedPlayerId = msg["taggedPlayerId"];
                 const auto msgTagCooldown = msg["coolDown"];
@@ -836,7 +1185,7 @@ static void ClientListener()
                     continue;
                 }
 
-                if (Players.List.size() == 0) 
+                if (Players.Count == 0) 
                 {
                     SendJsonMessage({
                         {"type", "endGameMode"},
@@ -860,11 +1209,11 @@ static void ClientListener()
                     } 
                     else 
                     {
-                        auto previousTaggedPlayer = GetPlayerById(PreviousTaggedId);
+                        const auto previousTaggedSlot = FindPlayer(PreviousTaggedId);
 
-                        if (previousTaggedPlayer) 
+                        if (previousTaggedSlot >= 0) 
                         {
-                            sprintf_s(buffer, sizeof(buffer), "[Tag] %s tagged %s", previousTaggedPlayer->Name.c_str(), UserClient.Name.c_str());
+                            sprintf_s(buffer, sizeof(buffer), "[Tag] %s tagged %s", Players.Name[previousTaggedSlot].c_str(), UserClient.Name.c_str());
                         }
                     }
 
@@ -877,6 +1226,11 @@ static void ClientListener()
                 TaggedTimed = GetTickCount64();
                 PreviousTaggedId = msgTaggedPlayerId;
                 IgnorePlayerInput(UserClient.Id == msgTaggedPlayerId);
+                break;
+            }
+
+            default:
+                break;
             }
         }
 
@@ -894,6 +1248,23 @@ static void ClientListener()
     }
 }
 
+static void OnPlayerBonesTick(Classes::USkeletalMeshComponent *component, Classes::TArray<Classes::FBoneAtom> *bones) 
+{
+    Players.Mutex.lock_shared();
+
+    for (auto i = 0; i < Players.Slots; ++i) 
+    {
+        const auto actor = Players.Actor[i];
+        if (actor && Players.Active[i] && Players.Received[i] && actor->SkeletalMeshComponent == component) 
+        {
+            Engine::TransformBones(Players.Character[i], bones, Players.Bones[i]);
+            break;
+        }
+    }
+
+    Players.Mutex.unlock_shared();
+}
+
 static void OnTick(float deltaTime) 
 {
     static float sum = 0;
@@ -917,6 +1288,7 @@ static void OnTick(float deltaTime)
                 packet.CompressedBones[i] = static_cast<short>( roundf(*reinterpret_cast<float *>(bonesBase + CompressedBoneOffsets[i]) * 215.0f));
             }
 
+            Trace::Instant("PlayerPacketSent");
             sendto(UDPSocket, reinterpret_cast<const char *>(&packet), sizeof(packet), 0, reinterpret_cast<const sockaddr *>(&Server), sizeof(Server));
 
             sum = 0;
@@ -926,7 +1298,7 @@ static void OnTick(float deltaTime)
 
 static void OnTickGames(float deltaTime) 
 {
-    if (UserClient.GameMode != GameMode_Tag) 
+    if (UserClient.GameMode != Client::GameModeType::Tag) 
     {
         return;
     }
@@ -986,33 +1358,52 @@ static void OnRender(IDirect3DDevice9 *device)
     static const auto inputWidthOffset = 50.0f;
     static const auto unfocusedChatMessages = 5;
 
+    DrainChatMessages();
+
     if (Players.ShowNameTags) 
     {
         auto window = ImGui::BeginRawScene("##client-backbuffer-nametags");
         Players.Mutex.lock_shared();
 
-        for (auto p : Players.List) 
+        Arena::Vector<int> named;
+        Arena::Vector<Classes::FVector> positions;
+
+        for (auto i = 0; i < Players.Slots; ++i) 
         {
-            if (p->Level == UserClient.Level && p->Actor && p->Actor->SkeletalMeshComponent) 
+            const auto actor = Players.Actor[i];
+            if (Players.Active[i] && actor && actor->SkeletalMeshComponent && Players.LevelId[i] == UserClient.LevelId) 
             {
-                auto pos = p->Actor->Location;
-                pos.Z = p->MaxZ + 27.5f;
+                auto pos = actor->Location;
+                pos.Z = Players.MaxZ[i] + 27.5f;
 
-                if (Engine::WorldToScreen(device, pos)) 
-                {
-                    auto size = ImGui::CalcTextSize(p->Name.c_str());
-                    auto topLeft = ImVec2(pos.X - size.x / 2.0f, pos.Y - size.y);
+                named.push_back(i);
+                positions.push_back(pos);
+            }
+        }
 
-                    window->DrawList->AddRectFilled(topLeft - ImVec2(3.0f, 1.0f), ImVec2(pos.X + size.x / 2.0f, pos.Y) + ImVec2(3.0f, 1.0f), ImColor(ImVec4(0, 0, 0, 0.4f)));
+        const auto visible = static_cast<bool *>(Arena::Allocate(positions.size() * sizeof(bool), alignof(bool)));
+        Engine::WorldToScreen(positions.data(), visible, positions.size());
 
-                    if (UserClient.GameMode == GameMode_Tag && p->Id == UserClient.TaggedPlayerId) 
-                    {
-                        window->DrawList->AddText(topLeft, ImColor(ImVec4(1.0f, 0.0f, 0.0f, 1.0f)), p->Name.c_str());
-                    } 
-                    else 
-                    {
-                        window->DrawList->AddText(topLeft, ImColor(ImVec4(1.0f, 1.0f, 1.0f, 1.0f)), p->Name.c_str());
-                    }
+        for (size_t i = 0; i < named.size(); ++i) 
+        {
+            const auto slot = named[i];
+            const auto &name = Players.Name[slot];
+            const auto &pos = positions[i];
+
+            if (visible[i]) 
+            {
+                auto size = ImGui::CalcTextSize(name.c_str());
+                auto topLeft = ImVec2(pos.X - size.x / 2.0f, pos.Y - size.y);
+
+                window->DrawList->AddRectFilled(topLeft - ImVec2(3.0f, 1.0f), ImVec2(pos.X + size.x / 2.0f, pos.Y) + ImVec2(3.0f, 1.0f), ImColor(ImVec4(0, 0, 0, 0.4f)));
+
+                if (UserClient.GameMode == Client::GameModeType::Tag && Players.Id[slot] == UserClient.TaggedPlayerId) 
+                {
+                    window->DrawList->AddText(topLeft, ImColor(ImVec4(1.0f, 0.0f, 0.0f, 1.0f)), name.c_str());
+                } 
+                else 
+                {
+                    window->DrawList->AddText(topLeft, ImColor(ImVec4(1.0f, 1.0f, 1.0f, 1.0f)), name.c_str());
                 }
             }
         }
@@ -1045,43 +1436,34 @@ static void OnRender(IDirect3DDevice9 *device)
 
     if (opacity > 0.0f) 
     {
-        Chat.Mutex.lock();
+        const auto first = Chat.Focused ? 0 : max(0, Chat.Count - unfocusedChatMessages);
 
-        auto body = Chat.Raw;
-        if (!Chat.Focused) 
+        auto height = ImGui::GetTextLineHeight() / 6.0f;
+        for (auto i = first; i < Chat.Count; ++i) 
         {
-            auto messages = 0;
-
-            for (auto i = static_cast<int>(body.size()) - 1; i >= 0; --i) 
+            auto &line = GetChatLine(i);
+            if (line.WrapWidth != width) 
             {
-                if (body[i] == '\n') 
-                {
-                    ++messages;
-                }
-
-                if (messages > unfocusedChatMessages) 
-                {
-                    body = body.substr(i + 1);
-                    break;
-                }
+                line.WrapWidth = width;
+                line.Height = ImGui::CalcTextSize(line.Text, line.Text + line.Length, false, width).y;
             }
-        }
-
-        const auto height = ImGui::CalcTextSize(body.c_str(), nullptr, false, width).y + (ImGui::GetTextLineHeight() / 6.0f);
-        const auto pos = ImVec2(inputWidthOffset, io.DisplaySize.y - inputHeightOffset - height);
 
-        ImGui::SetWindowPos(pos, ImGuiCond_Always);
-        ImGui::SetWindowSize(ImVec2(window->Size.x, max(window->Size.y, height)));
+            height += line.Height;
+        }
 
+        auto pos = ImVec2(inputWidthOffset, io.DisplaySize.y - inputHeightOffset - height);
         window->DrawList->AddRectFilled(pos, ImVec2(pos.x + width, pos.y + height), ImColor(ImVec4(0, 0, 0, 0.4f * opacity)));
 
-        ImGui::PushTextWrapPos(width);
-        ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1, 1, 1, opacity));
-        ImGui::TextWrapped("%s", body.c_str());
-        ImGui::PopStyleColor();
-        ImGui::PopTextWrapPos();
+        const auto font = ImGui::GetFont();
+        const auto fontSize = ImGui::GetFontSize();
+        const auto color = ImColor(ImVec4(1, 1, 1, opacity));
 
-        Chat.Mutex.unlock();
+        for (auto i = first; i < Chat.Count; ++i) 
+        {
+            const auto &line = GetChatLine(i);
+            window->DrawList->AddText(font, fontSize, pos, color, line.Text, line.Text + line.Length, width);
+            pos.y += line.Height;
+        }
     }
 
     ImGui::EndRawScene();
@@ -1116,7 +1498,7 @@ static void OnRenderGames(IDirect3DDevice9 *device)
         return;
     }
 
-    if (UserClient.Level.empty() || UserClient.Level == Map_MainMenu) 
+    if (UserClient.LevelId == 0 || UserClient.LevelId == MainMenuLevel) 
     {
         return;
     }
@@ -1124,12 +1506,12 @@ static void OnRenderGames(IDirect3DDevice9 *device)
     int playersInTheSameLevel = 0;
     float longestNameWidth = 0.0f;
 
-    for (const auto &p : Players.List) 
+    for (auto i = 0; i < Players.Slots; ++i) 
     {
-        if (p->Level == UserClient.Level && p->Actor) 
+        if (Players.Active[i] && Players.Actor[i] && Players.LevelId[i] == UserClient.LevelId) 
         {
             playersInTheSameLevel++;
-            float nameWidth = ImGui::CalcTextSize(p->Name.c_str(), nullptr, false).x;
+            float nameWidth = ImGui::CalcTextSize(Players.Name[i].c_str(), nullptr, false).x;
 
             if (nameWidth > longestNameWidth) 
             {
@@ -1160,14 +1542,14 @@ static void OnRenderGames(IDirect3DDevice9 *device)
 
         window->DrawList->AddRectFilled(ImVec2(), ImVec2(rightPadding + x + padding, y + padding + textHeight), ImColor(ImVec4(0, 0, 0, 0.4f)));
 
-        for (const auto &p : Players.List) 
+        for (auto i = 0; i < Players.Slots; ++i) 
         {
-            if (!p->Actor || p->Level != UserClient.Level) 
+            if (!Players.Active[i] || !Players.Actor[i] || Players.LevelId[i] != UserClient.LevelId) 
             {
                 continue;
             }
 
-            float dist = Distance(p->Actor->Location, pawn->Location);
+            float dist = Distance(Players.Actor[i]->Location, pawn->Location);
 
             if (dist >= 10.0f) 
             {
@@ -1178,17 +1560,17 @@ static void OnRenderGames(IDirect3DDevice9 *device)
                 sprintf_s(buffer, "%.1f m", dist);
             }
 
-            auto name = p->Name;
+            auto name = Players.Name[i];
             auto color = ImColor(ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
 
-            if (UserClient.GameMode == GameMode_Tag && p->Id == UserClient.TaggedPlayerId) {
+            if (UserClient.GameMode == Client::GameModeType::Tag && Players.Id[i] == UserClient.TaggedPlayerId) {
                 color = ImColor(ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
             }
 
             if (ImGui::CalcTextSize(name.c_str(), nullptr, false).x > maxNameWidth) {
                 int charactersToRemove = 3;
                 do {
-                    name = p->Name;
+                    name = Players.Name[i];
                     name = name.substr(0, name.size() - charactersToRemove++) + "...";
                 } while (ImGui::CalcTextSize(name.c_str(), nullptr, false).x > maxNameWidth);
             }
@@ -1221,14 +1603,14 @@ static void OnRenderGames(IDirect3DDevice9 *device)
 
         if (UserClient.Id != UserClient.TaggedPlayerId) 
         {
-            auto player = GetPlayerById(UserClient.TaggedPlayerId);
+            const auto slot = FindPlayer(UserClient.TaggedPlayerId);
 
-            if (!player) 
+            if (slot < 0) 
             {
                 return;
             }
 
-            playerName = player->Name;
+            playerName = Players.Name[slot];
         }
 
         auto name = playerName;
@@ -1412,9 +1794,7 @@ static void MultiplayerTab()
     ImGui::Separator(5.0f);
     ImGui::Text("Chat");
 
-    Chat.Mutex.lock();
-    ImGui::InputTextMultiline("##client-chat", const_cast<char *>(Chat.Raw.c_str()), Chat.Raw.size(), {0, 0}, ImGuiInputTextFlags_ReadOnly);
-    Chat.Mutex.unlock();
+    ImGui::InputTextMultiline("##client-chat", const_cast<char *>(Chat.Log.c_str()), Chat.Log.size() + 1, {0, 0}, ImGuiInputTextFlags_ReadOnly);
 
     if (ImGui::InputText("##client-chat-input", ChatInput, sizeof(ChatInput), ImGuiInputTextFlags_EnterReturnsTrue)) 
     {
@@ -1442,28 +1822,34 @@ static void MultiplayerTab()
     ImGui::Separator(5.0f);
 
     Players.Mutex.lock_shared();
-    if (ImGui::TreeNode("##client-players", "Players (%d)", Players.List.size())) 
+    if (ImGui::TreeNode("##client-players", "Players (%d)", Players.Count)) 
     {
-        for (auto p : Players.List) 
+        for (auto i = 0; i < Players.Slots; ++i) 
         {
-            ImGui::Text("%s - %s", p->Name.c_str(), p->Level.c_str());
+            if (!Players.Active[i]) 
+            {
+                continue;
+            }
+
+            const auto &level = Players.LevelId[i] == UnknownLevel ? Players.LevelName[i] : Intern::Name(Players.LevelId[i]);
+            ImGui::Text("%s - %s", Players.Name[i].c_str(), level.c_str());
             ImGui::SameLine();
 
-            if (p->Level == UserClient.Level && p->Actor) 
+            if (Players.LevelId[i] == UserClient.LevelId && Players.Actor[i]) 
             {
-                if (ImGui::Button(("Goto##client-goto-" + std::to_string(p->Id)).c_str()))
+                if (ImGui::Button(("Goto##client-goto-" + std::to_string(Players.Id[i])).c_str()))
                 {
                     auto pawn = Engine::GetPlayerPawn();
                     if (pawn)
                     {
-                        pawn->Location = p->Actor->Location;
+                        pawn->Location = Players.Actor[i]->Location;
                     }
                 }
             }
             else
             {
                 ImGui::BeginDisabled();
-                ImGui::Button(("Goto##client-goto-" + std::to_string(p->Id)).c_str());
+                ImGui::Button(("Goto##client-goto-" + std::to_string(Players.Id[i])).c_str());
                 ImGui::EndDisabled();
             }
         }
@@ -1483,13 +1869,13 @@ static void GamesTab()
         }
         ImGui::HelpMarker("Shows the distance to other players in meters. Tag doesn't need to be enabled for this");
 
-        if (UserClient.GameMode == GameMode_Tag)
+        if (UserClient.GameMode == Client::GameModeType::Tag)
         {
             ImGui::Checkbox("Cooldown Overlay##Tag-CooldownOverlay", &ShowTagCooldownOverlay);
             ImGui::HelpMarker("When someone gets tagged, it will show at the top middle of the screen of the cooldown in seconds until they can move again");
         }
 
-        if (UserClient.Level == Map_MainMenu || Players.List.size() == 0)
+        if (UserClient.LevelId == MainMenuLevel || Players.Count == 0)
         {
             ImGui::Separator(5.0f);
             ImGui::TextWrapped("You can't start tag when you're in the main menu or when there are no other players in the room!");
@@ -1498,7 +1884,7 @@ static void GamesTab()
         {
             char buffer[0xFF];
 
-            if (UserClient.GameMode == GameMode_None)
+            if (UserClient.GameMode == Client::GameModeType::None)
             {
                 ImGui::SliderInt("Cooldown Timer##Tag-CooldownSlider", &TagCooldown, 1, 60, "%d", ImGuiSliderFlags_AlwaysClamp);
                 ImGui::HelpMarker("Change to cooldown to be anywhere from 1 to 60. Cooldown is in seconds and default is 5");
@@ -1536,7 +1922,7 @@ static void GamesTab()
                 }
             }
 
-            if (UserClient.GameMode == GameMode_Tag)
+            if (UserClient.GameMode == Client::GameModeType::Tag)
             {
                 if (ImGui::Button("End Tag##Tag-EndTag"))
                 {
@@ -1610,37 +1996,49 @@ bool Client::Initialize()
         }
     });
 
-    Engine::OnActorTick([](Classes::AActor *actor) 
+    // Player actors come from SpawnCharacter, so the engine only calls this for them
+    Engine::OnWatchedActorTick([](Classes::AActor *actor) 
     {
-        if (!actor) {
-            return;
-        }
+        static const Classes::FName neck("Neck");
 
         Players.Mutex.lock_shared();
 
-        for (const auto &p : Players.List) 
+        for (auto i = 0; i < Players.Slots; ++i) 
         {
-            if (p->Actor == actor && p->Actor->SkeletalMeshComponent && p->Id == p->LastPacket.Id) 
+            if (Players.Actor[i] != actor) 
+            {
+                continue;
+            }
+
+            // Spawned after its player left
+            if (!Players.Active[i]) 
             {
-                p->Actor->Location = p->LastPacket.Position;
-                p->Actor->Rotation = {0, p->LastPacket.Yaw, 0};
-                p->MaxZ = p->Actor->SkeletalMeshComponent->GetBoneLocation("Neck", 0).Z;
+                Engine::Despawn(Players.Actor[i]);
+                Players.Actor[i] = nullptr;
+                break;
             }
-        }
 
-        Players.Mutex.unlock_shared();
-    });
+            const auto mesh = Players.Actor[i]->SkeletalMeshComponent;
 
-    Engine::OnBonesTick([](Classes::TArray<Classes::FBoneAtom> *bones) 
-    {
-        Players.Mutex.lock_shared();
+            // Once per spawn, the engine keeps the subscription until the actor is despawned
+            if (mesh && Players.Subscribed[i] != Players.Actor[i] && Engine::OnBonesTick(mesh, OnPlayerBonesTick)) 
+            {
+                Players.Subscribed[i] = Players.Actor[i];
+            }
 
-        for (const auto &p : Players.List) 
-        {
-            if (p->Actor && p->Actor->SkeletalMeshComponent && p->Actor->SkeletalMeshComponent->LocalAtoms.Buffer() == bones->Buffer() && p->Id == p->LastPacket.Id) 
+            if (mesh && Players.Received[i]) 
             {
-                Engine::TransformBones(p->Character, bones, p->LastPacket.Bones);
+                actor->Location = Players.Position[i];
+                actor->Rotation = {0, Players.Yaw[i], 0};
+
+                Classes::FVector neckLocation;
+                if (Engine::GetBoneLocation(mesh, Engine::GetBoneIndex(mesh, neck), neckLocation)) 
+                {
+                    Players.MaxZ[i] = neckLocation.Z;
+                }
             }
+
+            break;
         }
 
         Players.Mutex.unlock_shared();
@@ -1652,10 +2050,12 @@ bool Client::Initialize()
         IsLoading = true;
 
         UserClient.Level = GetLowercasedLevelName(levelNameW);
+        UserClient.LevelId = Intern::Get(UserClient.Level);
 
-        for (const auto &p : Players.List) 
+        // The engine drops queued spawns along with the old level's actors
+        for (auto i = 0; i < Players.Slots; ++i) 
         {
-            p->Actor = nullptr;
+            Players.Actor[i] = nullptr;
         }
 
         Players.Mutex.unlock_shared();
@@ -1663,15 +2063,15 @@ bool Client::Initialize()
 
     Engine::OnPostLevelLoad([](const wchar_t *) 
     {
-        if (UserClient.Level != Map_MainMenu) 
+        if (UserClient.LevelId != MainMenuLevel) 
         {
             Players.Mutex.lock_shared();
 
-            for (const auto &p : Players.List) 
+            for (auto i = 0; i < Players.Slots; ++i) 
             {
-                if (!p->Actor && p->Level == UserClient.Level) 
+                if (Players.Active[i] && !Players.Actor[i] && Players.LevelId[i] == UserClient.LevelId) 
                 {
-                    Engine::SpawnCharacter(p->Character, p->Actor);
+                    SpawnPlayer(i);
                 }
             }
 
@@ -1701,11 +2101,11 @@ bool Client::Initialize()
         Players.Mutex.lock_shared();
         IsLoading = false;
 
-        for (const auto &p : Players.List) 
+        for (auto i = 0; i < Players.Slots; ++i) 
         {
-            if (!p->Actor && p->Level == UserClient.Level) 
+            if (Players.Active[i] && !Players.Actor[i] && Players.LevelId[i] == UserClient.LevelId) 
             {
-                Engine::SpawnCharacter(p->Character, p->Actor);
+                SpawnPlayer(i);
             }
         }
 
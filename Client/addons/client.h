@@ -8,6 +8,7 @@
 #include <windows.h>
 #include <vector>
 #include "../engine.h"
+#include "../intern.h"
 
 static int CompressedBoneOffsets[] = {
     0x14,  0x20,  0x24,  0x28,  0x2C,  0x30,  0x34,  0x38,  0x40,  0x44,  0x48,
@@ -49,14 +50,6 @@ class Client : public Addon
     bool Initialize();
     std::string GetName();
 
-    typedef struct 
-    {
-        unsigned int Id;
-        Classes::FVector Position;
-        unsigned short Yaw;
-        Classes::FBoneAtom Bones[PLAYER_PAWN_BONE_COUNT];
-    } PACKET;
-
     typedef struct 
     {
         unsigned int Id;
@@ -65,6 +58,13 @@ class Client : public Addon
         short CompressedBones[ARRAYSIZE(CompressedBoneOffsets)];
     } PACKET_COMPRESSED;
 
+    enum class GameModeType 
+    {
+        None,
+        Tag,
+        Unknown
+    };
+
     class Player 
     {
       public:
@@ -72,17 +72,13 @@ class Client : public Addon
         Engine::Character Character;
         std::string Name;
         std::string Level;
-        Classes::ASkeletalMeshActorSpawnable *Actor;
-        float MaxZ;
-        PACKET LastPacket;
+        Intern::Id LevelId = 0;
 
-        std::string GameMode;
+        GameModeType GameMode = GameModeType::None;
         bool CanTag;
         unsigned int TaggedPlayerId;
         unsigned int CoolDownTag = 5;
     };
-
-    static std::vector<Client::Player *> GetPlayerList();
 };
 
 #pragma warning (pop)
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <algorithm>
 
+#include "../arena.h"
 #include "../imgui/imgui.h"
 #include "../menu.h"
 #include "../pattern.h"
@@ -213,6 +214,7 @@ static void DollyTab() {
     } else if (ImGui::Button("Start Recording##dolly-record")) {
         currentRecording.StartFrame = frame;
         currentRecording.Character = character;
+        currentRecording.Subscribed = nullptr;
         Engine::SpawnCharacter(currentRecording.Character, currentRecording.Actor);
         recording = true;
     }
@@ -366,6 +368,20 @@ static void OnTick(float) {
     auto pawn = Engine::GetPlayerPawn();
     auto controller = Engine::GetPlayerController();
 
+    if (hideQueued) {
+        hideQueued = false;
+
+        if (pawn) {
+            auto hide = playing || cameraView;
+            pawn->Mesh1p->SetHidden(hide);
+            pawn->Mesh1pLowerBody->SetHidden(hide);
+            pawn->Mesh3p->SetHidden(hide);
+
+            pawn->SetCollisionType(hide ? Classes::ECollisionType::COLLIDE_NoCollision
+                                        : Classes::ECollisionType::COLLIDE_BlockAllButWeapons);
+        }
+    }
+
     if (pawn && controller) {
         if (playing || cameraView) {
             if (markers.size() == 1) {
@@ -460,6 +476,9 @@ static void OnRender(IDirect3DDevice9 *device) {
     if (!playing) {
         auto window = ImGui::BeginRawScene("##dolly-backbuffer");
 
+        // Path samples first, then the markers, projected together
+        Arena::Vector<Classes::FVector> points;
+
         if (markers.size() > 1) {
             for (auto i = 0UL; i < markers.size() - 1; ++i) {
                 auto &m0 = markers[i];
@@ -485,17 +504,31 @@ static void OnRender(IDirect3DDevice9 *device) {
                                         GetMarkerField(i + 1, fieldOffset), s0[p], s1[p], t);
                     }
 
-                    if (Engine::WorldToScreen(device, pos)) {
-                        window->DrawList->AddCircleFilled(ImVec2(pos.X, pos.Y), 2000.0f / pos.Z,
-                                                          ImColor(ImVec4(1, 0, 0, 1)));
-                    }
+                    points.push_back(pos);
                 }
             }
         }
 
+        const auto samples = points.size();
         for (auto &m : markers) {
-            auto pos = m.Position;
-            if (Engine::WorldToScreen(device, pos)) {
+            points.push_back(m.Position);
+        }
+
+        const auto visible = static_cast<bool *>(
+            Arena::Allocate(points.size() * sizeof(bool), alignof(bool)));
+        Engine::WorldToScreen(points.data(), visible, points.size());
+
+        for (auto i = 0UL; i < samples; ++i) {
+            if (visible[i]) {
+                auto &pos = points[i];
+                window->DrawList->AddCircleFilled(ImVec2(pos.X, pos.Y), 2000.0f / pos.Z,
+                                                  ImColor(ImVec4(1, 0, 0, 1)));
+            }
+        }
+
+        for (auto i = samples; i < points.size(); ++i) {
+            if (visible[i]) {
+                auto &pos = points[i];
                 auto markerSize = 7500.0f / pos.Z;
 
                 ImVec2 topLeft(pos.X - markerSize, pos.Y - markerSize);
@@ -509,6 +542,21 @@ static void OnRender(IDirect3DDevice9 *device) {
     }
 }
 
+// Subscribed per recording actor from the watched actor tick
+static void OnRecordingBonesTick(Classes::USkeletalMeshComponent *component,
+                                 Classes::TArray<Classes::FBoneAtom> *bones) {
+    for (auto &r : recordings) {
+        if (r.Actor && r.Actor->SkeletalMeshComponent == component) {
+            if (frame >= r.StartFrame &&
+                frame < r.StartFrame + static_cast<int>(r.Frames.size())) {
+                Engine::TransformBones(r.Character, bones, r.Frames[frame - r.StartFrame].Bones);
+            }
+
+            break;
+        }
+    }
+}
+
 bool Dolly::Initialize() {
     forceRollPatch = Pattern::FindPattern("\x89\x93\x00\x00\x00\x00\xA1\x00\x00\x00\x00\x83\xB8",
                                           "xx????x????xx");
@@ -530,28 +578,17 @@ bool Dolly::Initialize() {
     Engine::OnTick(OnTick);
     Engine::OnRenderScene(OnRender);
 
-    Engine::OnActorTick([](Classes::AActor *actor) {
-        if (!actor) {
-            return;
-        }
-
-        if (hideQueued) {
-            hideQueued = false;
-
-            auto pawn = Engine::GetPlayerPawn();
-            if (pawn) {
-                auto hide = playing || cameraView;
-                pawn->Mesh1p->SetHidden(hide);
-                pawn->Mesh1pLowerBody->SetHidden(hide);
-                pawn->Mesh3p->SetHidden(hide);
-
-                pawn->SetCollisionType(hide ? Classes::ECollisionType::COLLIDE_NoCollision
-                                            : Classes::ECollisionType::COLLIDE_BlockAllButWeapons);
-            }
-        }
-
+    // Recording actors come from SpawnCharacter, so they're always watched
+    Engine::OnWatchedActorTick([](Classes::AActor *actor) {
         for (auto &r : recordings) {
             if (r.Actor == actor) {
+                const auto mesh = r.Actor->SkeletalMeshComponent;
+                if (mesh && r.Subscribed != r.Actor &&
+                    Engine::OnBonesTick(mesh, OnRecordingBonesTick)) {
+
+                    r.Subscribed = r.Actor;
+                }
+
                 if (frame >= r.StartFrame &&
                     frame < r.StartFrame + static_cast<int>(r.Frames.size())) {
                     auto &f = r.Frames[frame - r.StartFrame];
@@ -564,16 +601,6 @@ bool Dolly::Initialize() {
         }
     });
 
-    Engine::OnBonesTick([](Classes::TArray<Classes::FBoneAtom> *bones) {
-        for (auto &r : recordings) {
-            if (r.Actor && r.Actor->SkeletalMeshComponent &&
-                r.Actor->SkeletalMeshComponent->LocalAtoms.Buffer() == bones->Buffer() &&
-                frame >= r.StartFrame && frame < r.StartFrame + static_cast<int>(r.Frames.size())) {
-                Engine::TransformBones(r.Character, bones, r.Frames[frame - r.StartFrame].Bones);
-            }
-        }
-    });
-
     Engine::OnPreLevelLoad([](const wchar_t *levelName) {
         for (auto &r : recordings) {
             r.Actor = nullptr;
@@ -582,6 +609,7 @@ bool Dolly::Initialize() {
 
     Engine::OnPostLevelLoad([](const wchar_t *levelName) {
         for (auto &r : recordings) {
+            r.Subscribed = nullptr;
             Engine::SpawnCharacter(r.Character, r.Actor);
         }
     });
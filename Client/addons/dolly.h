@@ -36,5 +36,8 @@ class Dolly : public Addon {
         Engine::Character Character;
         Classes::ASkeletalMeshActorSpawnable *Actor;
         std::vector<Frame> Frames;
+
+        // The actor whose mesh is subscribed to the bones tick, once per spawn
+        Classes::ASkeletalMeshActorSpawnable *Subscribed = nullptr;
     };
 };
\ No newline at end of file
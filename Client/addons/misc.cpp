@@ -13,24 +13,26 @@
 
 #include "../string_utils.h"
 
-static bool Enabled = false;
+static Setting<bool> Enabled({ "Misc", "Enabled" }, false);
 static std::string LevelName;
 
-static bool ConsequtiveWallrunsLimitRemoved = false;
-static bool AutoLockDisabled = false;
-static bool AutoRollEnabled = false;
-static bool PermanentReactionTimeEnabled = false;
-static bool PermanentGameSpeedEnabled = false;
-static float PermanentGameSpeed = 0.25f;
-static bool NoWallrunChallenge = false;
-static bool NoWallclimbChallenge = false;
-static bool NoHealthRegenerationEnabled = false;
-
-static bool TunnelVisionEnabled = false;
-static bool TunnelVisionInverted = false;
+static Setting<bool> ConsequtiveWallrunsLimitRemoved({ "Misc", "ConsequtiveWallrunsLimitRemoved" }, false);
+static Setting<bool> AutoLockDisabled({ "Misc", "AutoLockDisabled" }, false);
+static Setting<bool> AutoRollEnabled({ "Misc", "AutoRollEnabled" }, false);
+static Setting<bool> PermanentReactionTimeEnabled({ "Misc", "PermanentReactionTimeEnabled" }, false);
+static Setting<bool> PermanentGameSpeedEnabled({ "Misc", "PermanentGameSpeedEnabled" }, false);
+static Setting<float> PermanentGameSpeed({ "Misc", "PermanentGameSpeed" }, 0.25f);
+static Setting<bool> NoWallrunChallenge({ "Misc", "Challenges", "NoWallrun" }, false);
+static Setting<bool> NoWallclimbChallenge({ "Misc", "Challenges", "NoWallclimb" }, false);
+static Setting<bool> NoHealthRegenerationEnabled({ "Misc", "Challenges", "NoHealthRegeneration" }, false);
+
+static Setting<bool> TunnelVisionEnabled({ "Misc", "TunnelVision", "Enabled" }, false);
+static Setting<bool> TunnelVisionInverted({ "Misc", "TunnelVision", "Inverted" }, false);
+static Setting<float> TunnelVisionWidth({ "Misc", "TunnelVision", "Width" }, 128.0f);
+static Setting<float> TunnelVisionHeight({ "Misc", "TunnelVision", "Height" }, 128.0f);
 static ImVec2 TunnelVisionSize = ImVec2(128.0f, 128.0f);
 
-static bool CustomColorScaleEnabled = false;
+static Setting<bool> CustomColorScaleEnabled({ "Misc", "ColorScale", "Enabled" }, false);
 static Classes::FVector CustomColorScaleValues = Classes::FVector{1.0f, 1.0f, 1.0f};
 
 enum class EOhko : uint8_t 
@@ -41,16 +43,16 @@ enum class EOhko : uint8_t
 
 static struct
 {
-    bool Enabled = false;
-    EOhko Type = EOhko::Normal;
+    Setting<bool> Enabled{ { "Misc", "OneHitKnockOut", "Enabled" }, false };
+    Setting<EOhko> Type{ { "Misc", "OneHitKnockOut", "Type" }, EOhko::Normal };
     int Health = 100;
 } OneHitKnockOut;
 
 static void MiscTab() 
 { 
-    if (ImGui::Checkbox("Enabled", &Enabled)) 
+    if (ImGui::Checkbox("Enabled", Enabled.Data())) 
     {
-        Settings::SetSetting({ "Misc", "Enabled" }, Enabled);
+        Enabled.Commit();
     }
 
     if (!Enabled) 
@@ -68,9 +70,9 @@ static void MiscTab()
 
     ImGui::Separator(5.0f);
 
-    if (ImGui::Checkbox("Auto Roll", &AutoRollEnabled)) 
+    if (ImGui::Checkbox("Auto Roll", AutoRollEnabled.Data())) 
     {
-        Settings::SetSetting({ "Misc", "AutoRollEnabled" }, AutoRollEnabled);
+        AutoRollEnabled.Commit();
 
         if (!AutoRollEnabled) 
         {
@@ -79,17 +81,17 @@ static void MiscTab()
     }
     ImGui::HelpMarker("If enabled, it will automatically roll every time for you");
 
-    if (ImGui::Checkbox("No Auto Lockon", &AutoLockDisabled))
+    if (ImGui::Checkbox("No Auto Lockon", AutoLockDisabled.Data()))
     {
-        Settings::SetSetting({ "Misc", "AutoLockDisabled" }, AutoLockDisabled);
+        AutoLockDisabled.Commit();
     }
     ImGui::HelpMarker("Disables the camera lock on when getting too close to an AI");
 
     // Color Scale
     {
-        if (ImGui::Checkbox("Customize Color Scale", &CustomColorScaleEnabled))
+        if (ImGui::Checkbox("Customize Color Scale", CustomColorScaleEnabled.Data()))
         {
-            Settings::SetSetting({ "Misc", "ColorScale", "Enabled" }, CustomColorScaleEnabled);
+            CustomColorScaleEnabled.Commit();
 
             if (!CustomColorScaleEnabled && controller->PlayerCamera)
             {
@@ -111,32 +113,32 @@ static void MiscTab()
 
     // Tunnel Vision
     {
-        if (ImGui::Checkbox("Tunnel Vision", &TunnelVisionEnabled))
+        if (ImGui::Checkbox("Tunnel Vision", TunnelVisionEnabled.Data()))
         {
-            Settings::SetSetting({ "Misc", "TunnelVision", "Enabled" }, TunnelVisionEnabled);
+            TunnelVisionEnabled.Commit();
         }
 
         if (TunnelVisionEnabled)
         {
-            if (ImGui::Checkbox("Tunnel Vision Inverted", &TunnelVisionInverted))
+            if (ImGui::Checkbox("Tunnel Vision Inverted", TunnelVisionInverted.Data()))
             {
-                Settings::SetSetting({ "Misc", "TunnelVision", "Inverted" }, TunnelVisionInverted);
+                TunnelVisionInverted.Commit();
             }
 
             ImGui::Text("Tunnel Vision Size");
             if (ImGui::InputFloat2("##TunnelVision-Size", &TunnelVisionSize.x, "%.2f", ImGuiInputTextFlags_EnterReturnsTrue))
             {
-                Settings::SetSetting({ "Misc", "TunnelVision", "Width" }, TunnelVisionSize.x);
-                Settings::SetSetting({ "Misc", "TunnelVision", "Height" }, TunnelVisionSize.y);
+                TunnelVisionWidth = TunnelVisionSize.x;
+                TunnelVisionHeight = TunnelVisionSize.y;
             }
             ImGui::HelpMarker("Customize the width and height. If you wanted cinematic bars, the width needs to be greater than half your "
                 "current width. For the height, it needs to be less than half the height. Press enter to save the width and height.\n\nDefault value for both is 128");
         }
     }
 
-    if (ImGui::Checkbox("No Consequtive Wallruns Limit", &ConsequtiveWallrunsLimitRemoved)) 
+    if (ImGui::Checkbox("No Consequtive Wallruns Limit", ConsequtiveWallrunsLimitRemoved.Data())) 
     {
-        Settings::SetSetting({ "Misc", "ConsequtiveWallrunsLimitRemoved" }, ConsequtiveWallrunsLimitRemoved);
+        ConsequtiveWallrunsLimitRemoved.Commit();
     }
     ImGui::HelpMarker("Removes the consequtive wallrun limit");
 
@@ -144,10 +146,10 @@ static void MiscTab()
     {
         if (!PermanentGameSpeedEnabled)
         {
-            if (ImGui::Checkbox("Permanent Reaction Time", &PermanentReactionTimeEnabled))
+            if (ImGui::Checkbox("Permanent Reaction Time", PermanentReactionTimeEnabled.Data()))
             {
-                Settings::SetSetting({ "Misc", "PermanentReactionTimeEnabled" }, PermanentReactionTimeEnabled);
-                Settings::SetSetting({ "Misc", "PermanentGameSpeedEnabled" }, PermanentGameSpeedEnabled = false);
+                PermanentReactionTimeEnabled.Commit();
+                PermanentGameSpeedEnabled = false;
 
                 pawn->WorldInfo->TimeDilation = 1.0f;
             }
@@ -156,7 +158,7 @@ static void MiscTab()
         else
         {
             ImGui::BeginDisabled();
-            ImGui::Checkbox("Permanent Reaction Time", &PermanentReactionTimeEnabled);
+            ImGui::Checkbox("Permanent Reaction Time", PermanentReactionTimeEnabled.Data());
             ImGui::EndDisabled();
         }
     }
@@ -165,10 +167,10 @@ static void MiscTab()
     {
         if (!PermanentReactionTimeEnabled)
         {
-            if (ImGui::Checkbox("Permanent Game Speed", &PermanentGameSpeedEnabled))
+            if (ImGui::Checkbox("Permanent Game Speed", PermanentGameSpeedEnabled.Data()))
             {
-                Settings::SetSetting({ "Misc", "PermanentGameSpeedEnabled" }, PermanentGameSpeedEnabled);
-                Settings::SetSetting({ "Misc", "PermanentReactionTimeEnabled" }, PermanentReactionTimeEnabled = false);
+                PermanentGameSpeedEnabled.Commit();
+                PermanentReactionTimeEnabled = false;
 
                 if (!PermanentGameSpeedEnabled)
                 {
@@ -179,31 +181,31 @@ static void MiscTab()
 
             if (PermanentGameSpeedEnabled)
             {
-                if (ImGui::InputFloat("Game Speed", &PermanentGameSpeed, 0.1f, 0.5f, "%.3f", ImGuiInputTextFlags_EnterReturnsTrue))
+                if (ImGui::InputFloat("Game Speed", PermanentGameSpeed.Data(), 0.1f, 0.5f, "%.3f", ImGuiInputTextFlags_EnterReturnsTrue))
                 {
-                    Settings::SetSetting({ "Misc", "PermanentGameSpeed" }, PermanentGameSpeed = max(0.1f, PermanentGameSpeed));
+                    PermanentGameSpeed = max(0.1f, PermanentGameSpeed.Get());
                 }
             }
         }
         else
         {
             ImGui::BeginDisabled();
-            ImGui::Checkbox("Permanent Game Speed", &PermanentGameSpeedEnabled);
+            ImGui::Checkbox("Permanent Game Speed", PermanentGameSpeedEnabled.Data());
             ImGui::EndDisabled();
         }
     }
 
     ImGui::SeparatorText("Challenges");
     {
-        if (ImGui::Checkbox("No Wallrun Challenge", &NoWallrunChallenge)) 
+        if (ImGui::Checkbox("No Wallrun Challenge", NoWallrunChallenge.Data())) 
         {
-            Settings::SetSetting({ "Misc", "Challenges", "NoWallrun" }, NoWallrunChallenge);
+            NoWallrunChallenge.Commit();
         }
         ImGui::HelpMarker("If you wallrun you start from new game");
 
-        if (ImGui::Checkbox("No Wallclimb Challenge", &NoWallclimbChallenge)) 
+        if (ImGui::Checkbox("No Wallclimb Challenge", NoWallclimbChallenge.Data())) 
         {
-            Settings::SetSetting({ "Misc", "Challenges", "NoWallclimb"}, NoWallclimbChallenge);
+            NoWallclimbChallenge.Commit();
         }
         ImGui::HelpMarker("If you wallclimb you start from new game");
 
@@ -211,9 +213,9 @@ static void MiscTab()
         {
             if (!OneHitKnockOut.Enabled) 
             {
-                if (ImGui::Checkbox("No Health Regeneration", &NoHealthRegenerationEnabled)) 
+                if (ImGui::Checkbox("No Health Regeneration", NoHealthRegenerationEnabled.Data())) 
                 {
-                    Settings::SetSetting({ "Misc", "Challenges", "NoHealthRegeneration" }, NoHealthRegenerationEnabled);
+                    NoHealthRegenerationEnabled.Commit();
             
                     OneHitKnockOut.Health = 100;
                     pawn->Health = pawn->MaxHealth;
@@ -224,7 +226,7 @@ static void MiscTab()
             else
             {
                 ImGui::BeginDisabled();
-                ImGui::Checkbox("No Health Regeneration", &NoHealthRegenerationEnabled);
+                ImGui::Checkbox("No Health Regeneration", NoHealthRegenerationEnabled.Data());
                 ImGui::HelpMarker("One Hit KO is on and this can't be enabled. It is the same except in One Hit KO, there's no health regeneration");
                 ImGui::EndDisabled();
             }
@@ -234,9 +236,9 @@ static void MiscTab()
         {
             if (!NoHealthRegenerationEnabled) 
             {
-                if (ImGui::Checkbox("One Hit KO", &OneHitKnockOut.Enabled))
+                if (ImGui::Checkbox("One Hit KO", OneHitKnockOut.Enabled.Data()))
                 {
-                    Settings::SetSetting({ "Misc", "OneHitKnockOut", "Enabled" }, OneHitKnockOut.Enabled);
+                    OneHitKnockOut.Enabled.Commit();
 
                     OneHitKnockOut.Health = 100;
                     pawn->Health = pawn->MaxHealth;
@@ -250,13 +252,13 @@ static void MiscTab()
 
                     if (ImGui::RadioButton("Normal", OneHitKnockOut.Type == EOhko::Normal))
                     {
-                        Settings::SetSetting({ "Misc", "OneHitKnockOut", "Type" }, OneHitKnockOut.Type = EOhko::Normal);
+                        OneHitKnockOut.Type = EOhko::Normal;
                     }
                     ImGui::HelpMarker("If you take any damage at all, you'll respawn at the last checkpoint");
 
                     if (ImGui::RadioButton("Extreme", OneHitKnockOut.Type == EOhko::Extreme))
                     {
-                        Settings::SetSetting({ "Misc", "OneHitKnockOut", "Type" }, OneHitKnockOut.Type = EOhko::Extreme);
+                        OneHitKnockOut.Type = EOhko::Extreme;
                     }
                     ImGui::HelpMarker("If you take any damage at all, it will instantly start a new game");
                 }
@@ -264,7 +266,7 @@ static void MiscTab()
             else
             {
                 ImGui::BeginDisabled();
-                ImGui::Checkbox("One Hit KO", &OneHitKnockOut.Enabled);
+                ImGui::Checkbox("One Hit KO", OneHitKnockOut.Enabled.Data());
                 ImGui::EndDisabled();
             }
         }
@@ -469,27 +471,9 @@ static void OnRender(IDirect3DDevice9* device)
 
 bool Misc::Initialize() 
 {
-    Enabled = Settings::GetSetting({ "Misc", "Enabled" }, false);
-
-    ConsequtiveWallrunsLimitRemoved = Settings::GetSetting({ "Misc", "ConsequtiveWallrunsLimitRemoved" }, false);
-    AutoRollEnabled = Settings::GetSetting({ "Misc", "AutoRollEnabled" }, false);
-    AutoLockDisabled = Settings::GetSetting({ "Misc", "AutoLockDisabled" }, false);
-    PermanentReactionTimeEnabled = Settings::GetSetting({ "Misc", "PermanentReactionTimeEnabled" }, false);
-    PermanentGameSpeedEnabled = Settings::GetSetting({ "Misc", "PermanentGameSpeedEnabled" }, false);
-    PermanentGameSpeed = Settings::GetSetting({ "Misc", "PermanentGameSpeed" }, 0.25f);
-    NoWallrunChallenge = Settings::GetSetting({ "Misc", "Challenges", "NoWallrun" }, false);
-    NoWallclimbChallenge = Settings::GetSetting({ "Misc", "Challenges", "NoWallclimb" }, false);
-    NoHealthRegenerationEnabled = Settings::GetSetting({ "Misc", "Challenges", "NoHealthRegeneration" }, false);
-
-    OneHitKnockOut.Enabled = Settings::GetSetting({ "Misc", "OneHitKnockOut", "Enabled" }, false);
-    OneHitKnockOut.Type = Settings::GetSetting({ "Misc", "OneHitKnockOut", "Type" }, EOhko::Normal).get<EOhko>();
-
-    TunnelVisionEnabled = Settings::GetSetting({ "Misc", "TunnelVision", "Enabled" }, false);
-    TunnelVisionInverted = Settings::GetSetting({ "Misc", "TunnelVision", "Inverted" }, false);
-    TunnelVisionSize.x = Settings::GetSetting({ "Misc", "TunnelVision", "Width" }, 128.0f);
-    TunnelVisionSize.y = Settings::GetSetting({ "Misc", "TunnelVision", "Height" }, 128.0f);
-
-    CustomColorScaleEnabled = Settings::GetSetting({ "Misc", "ColorScale", "Enabled" }, false);
+    // Handles are loaded with the settings, only the edit buffers are copied
+    TunnelVisionSize = ImVec2(TunnelVisionWidth, TunnelVisionHeight);
+
     CustomColorScaleValues = JsonToFVector(Settings::GetSetting({ "Misc", "ColorScale", "Values" }, FVectorToJson(Classes::FVector{1.0f, 1.0f, 1.0f})));
 
     Menu::AddTab("Misc", MiscTab);
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+
+#include "arena.h"
+#include "sdk.h"
+
+static const size_t InitialSize = 0x10000;
+
+static thread_local struct FrameArena {
+    char *Block = nullptr;
+    size_t Size = 0;
+    size_t Used = 0;
+    int Depth = 0;
+
+    // Allocations that didn't fit in the block. The block is grown to hold
+    // them on the next reset, so steady-state frames don't allocate at all
+    std::vector<void *> Overflow;
+    size_t OverflowSize = 0;
+
+    ~FrameArena() {
+        for (const auto allocation : Overflow) {
+            free(allocation);
+        }
+
+        free(Block);
+    }
+} arena;
+
+void *Arena::Allocate(size_t size, size_t alignment) {
+    // Nothing would ever reset the arena, e.g. on the client's network threads
+    if (arena.Depth == 0) {
+        return malloc(size);
+    }
+
+    if (!arena.Block) {
+        arena.Block = static_cast<char *>(malloc(arena.Size = InitialSize));
+    }
+
+    const auto offset = (arena.Used + alignment - 1) & ~(alignment - 1);
+    if (arena.Block && offset + size <= arena.Size) {
+        arena.Used = offset + size;
+        return arena.Block + offset;
+    }
+
+    // malloc is aligned for every type the arena types hold
+    const auto allocation = malloc(size);
+    arena.Overflow.push_back(allocation);
+    arena.OverflowSize += size + alignment;
+
+    return allocation;
+}
+
+void Arena::Deallocate(void *pointer) {
+    // Whoever allocated the memory frees it. The block and the overflow list
+    // are reclaimed when the frame ends, anything else came from the heap
+    // outside of a frame, whatever the depth is now
+    const auto address = static_cast<char *>(pointer);
+    if (address >= arena.Block && address < arena.Block + arena.Size) {
+        return;
+    }
+
+    if (std::find(arena.Overflow.rbegin(), arena.Overflow.rend(), pointer) !=
+        arena.Overflow.rend()) {
+        return;
+    }
+
+    free(pointer);
+}
+
+static void Reset() {
+    if (!arena.Overflow.empty()) {
+        for (const auto allocation : arena.Overflow) {
+            free(allocation);
+        }
+
+        arena.Overflow.clear();
+
+        free(arena.Block);
+        arena.Size = std::max(arena.Size * 2, arena.Size + arena.OverflowSize);
+        arena.Block = static_cast<char *>(malloc(arena.Size));
+        arena.OverflowSize = 0;
+    }
+
+    arena.Used = 0;
+}
+
+Arena::Frame::Frame() { ++arena.Depth; }
+
+Arena::Frame::~Frame() {
+    // Hooks can nest, e.g. EndScene inside Tick without a render thread
+    if (--arena.Depth == 0) {
+        Reset();
+    }
+}
+
+Arena::String Arena::GetName(const Classes::FName &name) {
+    const auto entry = Classes::FName::GetGlobalNames()[name.Index];
+    const auto length = std::wcslen(entry->WideName);
+
+    String str(length, '\0');
+    std::use_facet<std::ctype<wchar_t>>(std::locale())
+        .narrow(entry->WideName, entry->WideName + length, '?', &str[0]);
+
+    if (name.Number > 0) {
+        char suffix[16];
+        sprintf_s(suffix, sizeof(suffix), "_%d", name.Number - 1);
+        str += suffix;
+    }
+
+    return str;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Classes {
+struct FName;
+}
+
+namespace Arena {
+
+// Bump allocator for data that doesn't outlive the current tick or render
+// frame. Every thread has its own arena, which is reset when its outermost
+// Frame ends. Nothing allocated from it may be kept past that point. Outside
+// of a Frame it falls back to the heap.
+void *Allocate(size_t size, size_t alignment);
+
+// Frees heap allocations made outside of a Frame, wherever it's called from.
+// Memory from the arena is only reclaimed when its frame ends.
+void Deallocate(void *pointer);
+
+// Marks the extent of a frame. TickHook and EndSceneHook open one, so tick
+// and render callbacks can use the arena types freely.
+class Frame {
+public:
+    Frame();
+    ~Frame();
+
+    Frame(const Frame &) = delete;
+    Frame &operator=(const Frame &) = delete;
+};
+
+template <typename T> struct Allocator {
+    typedef T value_type;
+
+    Allocator() = default;
+    template <typename U> Allocator(const Allocator<U> &) {}
+
+    T *allocate(size_t count) {
+        return static_cast<T *>(Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *pointer, size_t) { Deallocate(pointer); }
+
+    template <typename U> bool operator==(const Allocator<U> &) const {
+        return true;
+    }
+
+    template <typename U> bool operator!=(const Allocator<U> &) const {
+        return false;
+    }
+};
+
+typedef std::basic_string<char, std::char_traits<char>, Allocator<char>> String;
+
+template <typename T> using Vector = std::vector<T, Allocator<T>>;
+
+// Same as FName::GetName, but allocated from the frame arena
+String GetName(const Classes::FName &name);
+
+} // namespace Arena
@@ -1,9 +1,18 @@
+#include <algorithm>
 #include <mutex>
+#include <thread>
 #include <vector>
 
+#include <xmmintrin.h>
+
+#include "arena.h"
 #include "engine.h"
 #include "hook.h"
 #include "pattern.h"
+#include "profiler.h"
+#include "queue.h"
+#include "settings.h"
+#include "trace.h"
 
 #include "imgui/imgui.h"
 #include "imgui/imgui_impl_dx9.h"
@@ -12,9 +21,15 @@
 #pragma warning (push)
 #pragma warning (disable: 26495)
 
+// A registered callback and the profiler counter timing it
+template <typename T> struct HookCallback {
+    T Callback;
+    Profiler::Counter *Counter;
+};
+
 // D3D9 and window hooks
 static struct {
-    std::vector<RenderSceneCallback> Callbacks;
+    std::vector<HookCallback<RenderSceneCallback>> Callbacks;
     HRESULT(WINAPI *Original)(IDirect3DDevice9 *) = nullptr;
 } renderScene;
 
@@ -26,31 +41,57 @@ static struct {
 static struct {
     bool BlockInput = false;
     byte KeysDown[0x100] = {0};
-    std::vector<InputCallback> InputCallbacks;
-    std::vector<InputCallback> SuperInputCallbacks;
+    std::vector<HookCallback<InputCallback>> InputCallbacks;
+    std::vector<HookCallback<InputCallback>> SuperInputCallbacks;
 
     HWND Window;
     WNDPROC WndProc = nullptr;
+    std::vector<ExitCallback> ExitCallbacks;
     BOOL(WINAPI *PeekMessage)(LPMSG, HWND, UINT, UINT, UINT) = nullptr;
 } window;
 
 static HMODULE(WINAPI *LoadLibraryAOriginal)(const char *) = nullptr;
 
 // Engine hooks
+
+// Deferred game thread work. Any thread can queue it, TickHook drains at most
+// a budget's worth per tick
+struct QueuedCommand {
+    wchar_t Text[0x200];
+};
+
+struct QueuedSpawn {
+    Engine::Character Character;
+    Classes::ASkeletalMeshActorSpawnable **Spawned;
+    bool *Pending;
+};
+
 static struct {
-    std::vector<std::wstring> Queue;
-    std::mutex Mutex;
+    BoundedQueue<QueuedCommand, 64> Queue;
+    const int Budget = 32;
 } commands;
 
 static struct {
-    std::vector<
-        std::pair<Engine::Character, Classes::ASkeletalMeshActorSpawnable *&>>
-        Queue;
-    std::mutex Mutex;
+    BoundedQueue<QueuedSpawn, 64> Queue;
+    const int Budget = 8;
 } spawns;
 
+struct ProcessEventSubscription {
+    Classes::UFunction *Function;
+    std::vector<HookCallback<ProcessEventCallback>> Callbacks;
+};
+
 static struct {
-    std::vector<ProcessEventCallback> Callbacks;
+    // Wildcard callbacks, called for every event
+    std::vector<HookCallback<ProcessEventCallback>> Callbacks;
+
+    // Indexed by the UFunction's GObjects slot
+    std::vector<ProcessEventSubscription *> Functions;
+
+    // Functions whose package wasn't loaded yet, retried after each level load
+    std::vector<std::pair<std::string, HookCallback<ProcessEventCallback>>>
+        Pending;
+
     int(__thiscall *Original)(Classes::UObject *, class Classes::UFunction *,
                               void *, void *) = nullptr;
 } processEvent;
@@ -72,13 +113,57 @@ static struct {
     int (*PostOriginal)();
 } death;
 
+struct ActorClassSubscription {
+    std::string Name;
+    Classes::UClass *Class;
+    HookCallback<ActorTickCallback> Callback;
+};
+
+enum class ActorClassInterest : unsigned char { Unknown, None, Some };
+
+static const size_t ActorWatchWords = 0x8000;
+
 static struct {
-    std::vector<ActorTickCallback> Callbacks;
+    // Wildcard callbacks, called for every ticking actor
+    std::vector<HookCallback<ActorTickCallback>> Callbacks;
+
+    // Called for watched actors only. One bit per GObjects slot, set by
+    // WatchActor and cleared by UnwatchActor or a level load
+    std::vector<HookCallback<ActorTickCallback>> WatchedCallbacks;
+    std::atomic<unsigned int> Watched[ActorWatchWords] = {};
+
+    // Called for actors of a class or its subclasses. Whether any
+    // subscription matches is cached by the actor class' GObjects slot, so
+    // uninteresting classes cost a single lookup
+    std::vector<ActorClassSubscription> ClassCallbacks;
+    std::vector<ActorClassInterest> ClassInterest;
+
     void *(__thiscall *Original)(Classes::AActor *, void *) = nullptr;
 } actorTick;
 
+struct BonesSubscription {
+    Classes::USkeletalMeshComponent *Component;
+    ComponentBonesTickCallback Callback;
+
+    // The watched actor owning the component and its GObjects slot
+    Classes::AActor *Owner;
+    size_t OwnerIndex;
+};
+
 static struct {
-    std::vector<BonesTickCallback> Callbacks;
+    // Wildcard callbacks, called for every mesh that updates its bones
+    std::vector<HookCallback<BonesTickCallback>> Callbacks;
+
+    // Keyed by the component's LocalAtoms buffer, which is what the hook is
+    // handed. Game thread only, other threads queue their unsubscribes
+    std::unordered_map<const Classes::FBoneAtom *, BonesSubscription> Components;
+
+    // Subscriptions of components that have released their bones, rekeyed
+    // once the component allocates them again
+    std::vector<BonesSubscription> Parked;
+    BoundedQueue<Classes::USkeletalMeshComponent *, 64> Unsubscribes;
+    Profiler::Counter *ComponentCounter = nullptr;
+
     void *(__thiscall *Original)(void *, void *) = nullptr;
 } bonesTick;
 
@@ -87,8 +172,47 @@ static struct {
     int *(__thiscall *Original)(Classes::FMatrix *, void *) = nullptr;
 } projectionTick;
 
+// Copies Count consecutive bones starting at Source to Dest onwards
+struct BoneRun {
+    unsigned short Dest;
+    unsigned short Source;
+    unsigned short Count;
+};
+
+// Maps the player's skeleton onto a character's skeleton by bone name. Built
+// on the game thread when the character is spawned, only bones that exist in
+// both skeletons are mapped. Matching bones are merged into runs, so applying
+// a table is a handful of copies
+struct RetargetTable {
+    Classes::USkeletalMesh *Mesh = nullptr;
+    size_t BoneCount = 0;
+    size_t Mapped = 0;
+    std::vector<BoneRun> Runs;
+};
+
 static struct {
-    std::vector<TickCallback> Callbacks;
+    std::vector<Classes::FName> SourceNames;
+    RetargetTable Tables[static_cast<int>(Engine::Character::Max)];
+} retarget;
+
+// Bone indices resolved by name, per skeletal mesh. Meshes only reference a
+// few bones by name, so each holds a short list. Game thread only
+static struct {
+    std::unordered_map<const Classes::USkeletalMesh *,
+                       std::vector<std::pair<Classes::FName, int>>>
+        Meshes;
+} boneIndices;
+
+// Camera state captured once per rendered frame for projecting to screen space
+static struct {
+    bool Valid = false;
+    D3DXMATRIX ViewProjection;
+    float Width = 0.0f;
+    float Height = 0.0f;
+} camera;
+
+static struct {
+    std::vector<HookCallback<TickCallback>> Callbacks;
     void(__thiscall *Original)(float *, int, float) = nullptr;
 } tick;
 
@@ -99,7 +223,12 @@ extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg
 
 // D3D9 and window hook implementations
 LRESULT CALLBACK WndProcHook(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
+static void UpdateCamera(IDirect3DDevice9 *device);
+
 HRESULT WINAPI EndSceneHook(IDirect3DDevice9 *device) {
+    Trace::Span span("EndScene");
+    Arena::Frame frame;
+
     static bool init = true;
     if (init) {
         D3DDEVICE_CREATION_PARAMETERS params;
@@ -124,8 +253,10 @@ HRESULT WINAPI EndSceneHook(IDirect3DDevice9 *device) {
     ImGui_ImplWin32_NewFrame();
     ImGui::NewFrame();
 
+    UpdateCamera(device);
+
     for (const auto &callback : renderScene.Callbacks) {
-        callback(device);
+        Profiler::Call(callback.Counter, callback.Callback, device);
     }
 
     ImGui::EndFrame();
@@ -167,12 +298,12 @@ void HandleMessage(HWND hWnd, UINT &msg, WPARAM wParam, LPARAM lParam) {
                 const auto block = window.BlockInput;
 
                 for (const auto &callback : window.SuperInputCallbacks) {
-                    callback(msg, wParam);
+                    Profiler::Call(callback.Counter, callback.Callback, msg, wParam);
                 }
 
                 if (!block) {
                     for (const auto &callback : window.InputCallbacks) {
-                        callback(msg, wParam);
+                        Profiler::Call(callback.Counter, callback.Callback, msg, wParam);
                     }
                 }
 
@@ -189,12 +320,12 @@ void HandleMessage(HWND hWnd, UINT &msg, WPARAM wParam, LPARAM lParam) {
                 const auto block = window.BlockInput;
 
                 for (const auto &callback : window.SuperInputCallbacks) {
-                    callback(msg, wParam);
+                    Profiler::Call(callback.Counter, callback.Callback, msg, wParam);
                 }
 
                 if (!block) {
                     for (const auto &callback : window.InputCallbacks) {
-                        callback(msg, wParam);
+                        Profiler::Call(callback.Counter, callback.Callback, msg, wParam);
                     }
                 }
 
@@ -216,6 +347,13 @@ LRESULT CALLBACK WndProcHook(HWND hWnd, UINT msg, WPARAM wParam,
     }
 
     HandleMessage(hWnd, msg, wParam, lParam);
+
+    if (msg == WM_DESTROY && hWnd == window.Window) {
+        for (const auto &callback : window.ExitCallbacks) {
+            callback();
+        }
+    }
+
     return CallWindowProc(window.WndProc, hWnd, msg, wParam, lParam);
 }
 
@@ -255,32 +393,129 @@ int __fastcall ProcessEventHook(Classes::UObject *object, void *idle,
                                 class Classes::UFunction *function, void *args,
                                 void *result) {
 
+    const auto index = static_cast<size_t>(function->ObjectInternalInteger);
+    auto subscription = index < processEvent.Functions.size()
+                            ? processEvent.Functions[index]
+                            : nullptr;
+
+    if (subscription && subscription->Function != function) {
+        subscription = nullptr;
+    }
+
+    if (!subscription && processEvent.Callbacks.empty()) {
+        return processEvent.Original(object, function, args, result);
+    }
+
+    Trace::Span span("ProcessEvent");
+
     auto sum = 0;
-    for (auto callback : processEvent.Callbacks) {
-        sum += callback(object, function, args, result);
+    if (subscription) {
+        for (const auto &callback : subscription->Callbacks) {
+            sum += Profiler::Call(callback.Counter, callback.Callback, object,
+                                  function, args, result);
+        }
+    }
+
+    for (const auto &callback : processEvent.Callbacks) {
+        sum += Profiler::Call(callback.Counter, callback.Callback, object,
+                              function, args, result);
     }
 
     return sum == 0 ? processEvent.Original(object, function, args, result) : 0;
 }
 
+static bool
+SubscribeProcessEvent(const std::string &name,
+                      const HookCallback<ProcessEventCallback> &callback) {
+
+    const auto function =
+        Classes::UObject::FindObject<Classes::UFunction>(name);
+
+    if (!function) {
+        return false;
+    }
+
+    const auto index = static_cast<size_t>(function->ObjectInternalInteger);
+    if (index >= processEvent.Functions.size()) {
+        processEvent.Functions.resize(index + 1, nullptr);
+    }
+
+    auto &subscription = processEvent.Functions[index];
+    if (!subscription || subscription->Function != function) {
+        // The slot belonged to a function that has since been unloaded
+        delete subscription;
+        subscription = new ProcessEventSubscription{function};
+    }
+
+    subscription->Callbacks.push_back(callback);
+    return true;
+}
+
 int __fastcall LevelLoadHook(void *this_, void *idle, void **levelInfo,
                              unsigned long long arg) {
 
+    Trace::Span span("LevelLoad");
+
     const auto levelName = reinterpret_cast<const wchar_t *>(levelInfo[7]);
 
     for (const auto &callback : levelLoad.PreCallbacks) {
         callback(levelName);
     }
 
-    spawns.Mutex.lock();
-    spawns.Queue.clear();
-    spawns.Queue.shrink_to_fit();
+    // Spawns queued for the old level are dropped
+    while (spawns.Queue.Pop([](QueuedSpawn &queued) {
+        if (queued.Pending) {
+            *queued.Pending = false;
+        }
+    })) {
+    }
+
+    // The old level's actors are gone and their slots will be reused
+    for (auto &word : actorTick.Watched) {
+        word.store(0, std::memory_order_relaxed);
+    }
+
+    while (bonesTick.Unsubscribes.Pop([](Classes::USkeletalMeshComponent *&) {})) {
+    }
+
+    bonesTick.Components.clear();
+    bonesTick.Parked.clear();
+
+    // Meshes unloaded with the old level may have their addresses reused
+    boneIndices.Meshes.clear();
+
+    retarget.SourceNames.clear();
+    for (auto &table : retarget.Tables) {
+        table = {};
+    }
 
     levelLoad.Loading = true;
     const auto ret = levelLoad.Original(this_, levelInfo, arg);
     levelLoad.Loading = false;
 
-    spawns.Mutex.unlock();
+    // The old level's objects were collected and their slots may be reused
+    Classes::UObject::InvalidateObjectIndex();
+
+    for (auto &subscription : actorTick.ClassCallbacks) {
+        if (!subscription.Class) {
+            subscription.Class =
+                Classes::UObject::FindClass(subscription.Name);
+        }
+    }
+
+    // Class slots may have been reused by classes loaded with the level
+    actorTick.ClassInterest.clear();
+
+    if (!processEvent.Pending.empty()) {
+        auto pending = std::move(processEvent.Pending);
+        processEvent.Pending.clear();
+
+        for (const auto &entry : pending) {
+            if (!SubscribeProcessEvent(entry.first, entry.second)) {
+                processEvent.Pending.push_back(entry);
+            }
+        }
+    }
 
     for (const auto &callback : levelLoad.PostCallbacks) {
         callback(levelName);
@@ -290,6 +525,8 @@ int __fastcall LevelLoadHook(void *this_, void *idle, void **levelInfo,
 }
 
 int PreDeathHook() {
+    Trace::Span span("PreDeath");
+
     for (const auto &callback : death.PreCallbacks) {
         callback();
     }
@@ -298,6 +535,8 @@ int PreDeathHook() {
 }
 
 int PostDeathHook() {
+    Trace::Span span("PostDeath");
+
     const auto ret = death.PostOriginal();
 
     for (const auto &callback : death.PostCallbacks) {
@@ -339,9 +578,68 @@ HMODULE WINAPI LoadLibraryAHook(const char *module) {
     return LoadLibraryAOriginal(module);
 }
 
+static bool IsSlotWatched(size_t index) {
+    if (index / 32 >= ActorWatchWords) {
+        return false;
+    }
+
+    const auto word = actorTick.Watched[index / 32].load(std::memory_order_relaxed);
+    return (word & (1u << (index % 32))) != 0;
+}
+
+static bool IsActorWatched(const Classes::AActor *actor) {
+    return IsSlotWatched(static_cast<size_t>(actor->ObjectInternalInteger));
+}
+
+static bool IsActorClassOfInterest(const Classes::AActor *actor) {
+    const auto index = static_cast<size_t>(actor->Class->ObjectInternalInteger);
+    if (index >= actorTick.ClassInterest.size()) {
+        actorTick.ClassInterest.resize(index + 1, ActorClassInterest::Unknown);
+    }
+
+    auto &interest = actorTick.ClassInterest[index];
+    if (interest == ActorClassInterest::Unknown) {
+        interest = ActorClassInterest::None;
+
+        for (const auto &subscription : actorTick.ClassCallbacks) {
+            if (subscription.Class && actor->IsA(subscription.Class)) {
+                interest = ActorClassInterest::Some;
+                break;
+            }
+        }
+    }
+
+    return interest == ActorClassInterest::Some;
+}
+
 void *__fastcall ActorTickHook(Classes::AActor *actor, void *idle, void *arg) {
+    const auto watched =
+        !actorTick.WatchedCallbacks.empty() && IsActorWatched(actor);
+
+    const auto classed =
+        !actorTick.ClassCallbacks.empty() && IsActorClassOfInterest(actor);
+
+    if (!watched && !classed && actorTick.Callbacks.empty()) {
+        return actorTick.Original(actor, arg);
+    }
+
+    if (watched) {
+        for (const auto &callback : actorTick.WatchedCallbacks) {
+            Profiler::Call(callback.Counter, callback.Callback, actor);
+        }
+    }
+
+    if (classed) {
+        for (const auto &subscription : actorTick.ClassCallbacks) {
+            if (subscription.Class && actor->IsA(subscription.Class)) {
+                const auto &callback = subscription.Callback;
+                Profiler::Call(callback.Counter, callback.Callback, actor);
+            }
+        }
+    }
+
     for (const auto &callback : actorTick.Callbacks) {
-        callback(actor);
+        Profiler::Call(callback.Counter, callback.Callback, actor);
     }
 
     return actorTick.Original(actor, arg);
@@ -352,8 +650,18 @@ void *__fastcall BonesTickHook(void *this_, void *idle, void *arg) {
         bonesTick.Original(this_, arg));
 
     if (bones->Num()) {
+        if (!bonesTick.Components.empty()) {
+            const auto subscription = bonesTick.Components.find(bones->Buffer());
+
+            if (subscription != bonesTick.Components.end()) {
+                Profiler::Call(bonesTick.ComponentCounter,
+                               subscription->second.Callback,
+                               subscription->second.Component, bones);
+            }
+        }
+
         for (const auto &callback : bonesTick.Callbacks) {
-            callback(bones);
+            Profiler::Call(callback.Counter, callback.Callback, bones);
         }
     }
 
@@ -367,6 +675,104 @@ int *__fastcall ProjectionTick(Classes::FMatrix *matrix, void *idle,
     return projectionTick.Original(matrix, arg);
 }
 
+// GetBoneNames allocates the names with the engine's allocator, which the
+// SDK's TArray never frees. The parameters are kept across calls instead, so
+// the engine reallocates the previous names when it fills them again and only
+// the latest array stays alive. Game thread only
+static std::vector<Classes::FName>
+GetBoneNames(Classes::USkeletalMeshComponent *component) {
+    static auto fn = Classes::UObject::FindObject<Classes::UFunction>(
+        "Function Engine.SkeletalMeshComponent.GetBoneNames");
+    static Classes::USkeletalMeshComponent_GetBoneNames_Params params;
+
+    component->ProcessEvent(fn, &params);
+
+    const auto &names = params.BoneNames;
+    return std::vector<Classes::FName>(names.Buffer(),
+                                       names.Buffer() + names.Num());
+}
+
+// Player bones a character's table leaves out even when a bone of the same name
+// exists, as the hand-written copies the tables replaced did. Only Faith and
+// Ghost share the player's whole skeleton
+static bool IsRetargetSkipped(Engine::Character character, size_t bone) {
+    switch (character) {
+    case Engine::Character::Faith:
+    case Engine::Character::Ghost:
+        return false;
+    case Engine::Character::Kate:
+        return (bone >= 7 && bone < 14) ||
+               (bone >= 24 && bone < 45 && bone != 39 && bone != 42);
+    default:
+        return bone >= 7 && bone < 45 && bone != 18;
+    }
+}
+
+static void BuildRetargetTable(Engine::Character character,
+                               Classes::ATdPlayerPawn *source,
+                               Classes::USkeletalMeshComponent *target) {
+
+    const auto name = Engine::Characters[static_cast<int>(character)];
+
+    if (!target->SkeletalMesh) {
+        printf("engine: can't retarget %s, it has no mesh\n", name);
+        return;
+    }
+
+    auto &table = retarget.Tables[static_cast<int>(character)];
+    if (table.Mesh == target->SkeletalMesh) {
+        return;
+    }
+
+    if (retarget.SourceNames.empty() && source->Mesh3p) {
+        retarget.SourceNames = GetBoneNames(source->Mesh3p);
+    }
+
+    if (retarget.SourceNames.empty()) {
+        printf("engine: can't retarget %s, the player has no mesh\n", name);
+        return;
+    }
+
+    const auto targetNames = GetBoneNames(target);
+    const auto sourceCount =
+        min(retarget.SourceNames.size(), static_cast<size_t>(PLAYER_PAWN_BONE_COUNT));
+
+    table.Mesh = target->SkeletalMesh;
+    table.BoneCount = targetNames.size();
+    table.Mapped = 0;
+    table.Runs.clear();
+
+    for (size_t dest = 0; dest < targetNames.size(); ++dest) {
+        for (size_t src = 0; src < sourceCount; ++src) {
+            if (!(retarget.SourceNames[src] == targetNames[dest])) {
+                continue;
+            }
+
+            if (IsRetargetSkipped(character, src)) {
+                break;
+            }
+
+            auto *run = table.Runs.empty() ? nullptr : &table.Runs.back();
+            if (run && run->Dest + run->Count == dest &&
+                run->Source + run->Count == src) {
+
+                ++run->Count;
+            } else {
+                table.Runs.push_back({static_cast<unsigned short>(dest),
+                                      static_cast<unsigned short>(src), 1});
+            }
+
+            ++table.Mapped;
+            break;
+        }
+    }
+
+    if (table.Mapped == 0) {
+        printf("engine: can't retarget %s, no bones match the player's\n",
+               name);
+    }
+}
+
 Classes::ASkeletalMeshActorSpawnable *
 SpawnCharacter(Engine::Character character) {
 
@@ -516,49 +922,159 @@ SpawnCharacter(Engine::Character character) {
         actor->PrePivot.Z = 94;
     }
 
+    BuildRetargetTable(character, player, mesh);
+
     mesh->bUpdateSkelWhenNotRendered = true;
     return actor;
 }
 
+static void RemoveBonesSubscription(
+    const Classes::USkeletalMeshComponent *component) {
+
+    for (auto it = bonesTick.Components.begin();
+         it != bonesTick.Components.end(); ++it) {
+
+        if (it->second.Component == component) {
+            bonesTick.Components.erase(it);
+            return;
+        }
+    }
+
+    auto &parked = bonesTick.Parked;
+    parked.erase(std::remove_if(parked.begin(), parked.end(),
+                                [component](const BonesSubscription &entry) {
+                                    return entry.Component == component;
+                                }),
+                 parked.end());
+}
+
+static void RefreshBonesSubscriptions() {
+    const auto unsubscribe = [](Classes::USkeletalMeshComponent *&component) {
+        RemoveBonesSubscription(component);
+    };
+
+    while (bonesTick.Unsubscribes.Pop(unsubscribe)) {
+    }
+
+    // An owner is unwatched as soon as it's despawned, and its slot only
+    // holds it until it's collected. Either way its component may be gone,
+    // so this is checked without touching the component
+    const auto &objects = Classes::UObject::GetGlobalObjects();
+    const auto alive = [&objects](const BonesSubscription &subscription) {
+        const auto index = subscription.OwnerIndex;
+        return IsSlotWatched(index) && index < objects.Num() &&
+               objects.GetByIndex(index) == subscription.Owner;
+    };
+
+    // LocalAtoms is reallocated when the mesh changes, and released while the
+    // component has no bones
+    Arena::Vector<BonesSubscription> moved;
+    for (auto it = bonesTick.Components.begin();
+         it != bonesTick.Components.end();) {
+
+        if (!alive(it->second)) {
+            it = bonesTick.Components.erase(it);
+            continue;
+        }
+
+        if (it->second.Component->LocalAtoms.Buffer() == it->first) {
+            ++it;
+            continue;
+        }
+
+        moved.push_back(it->second);
+        it = bonesTick.Components.erase(it);
+    }
+
+    for (const auto &subscription : bonesTick.Parked) {
+        if (alive(subscription)) {
+            moved.push_back(subscription);
+        }
+    }
+
+    bonesTick.Parked.clear();
+
+    for (const auto &subscription : moved) {
+        const auto buffer = subscription.Component->LocalAtoms.Buffer();
+
+        if (buffer) {
+            bonesTick.Components[buffer] = subscription;
+        } else {
+            bonesTick.Parked.push_back(subscription);
+        }
+    }
+}
+
+// GNames entries or GObjects slots indexed per tick until the object index is
+// complete, about a millisecond's worth
+static const uint32_t ObjectIndexBudget = 4096;
+
 void __fastcall TickHook(float *scales, void *idle, int arg, float delta) {
+    Trace::Span span("Tick");
+    Arena::Frame frame;
+
+    // Resolve SDK lookups up front instead of on their first use. The index
+    // walks GObjects and GNames, so it's built here, in sync with the engine,
+    // a slice per tick so building it doesn't stall a frame
+    static auto indexed = false;
+    if (!indexed) {
+        Trace::Span indexSpan("ObjectIndex");
+
+        indexed = Classes::UObject::PrepareObjectIndex(ObjectIndexBudget);
+    }
+
+    if (!bonesTick.Components.empty() || !bonesTick.Parked.empty() ||
+        !bonesTick.Unsubscribes.Empty()) {
+        RefreshBonesSubscriptions();
+    }
+
     if (Engine::GetPlayerPawn(true)) {
         // Queues must be executed inside the context of an engine thread in
         // sync with a tick
-        if (commands.Queue.size() > 0) {
+        if (!commands.Queue.Empty()) {
+            Trace::Span commandsSpan("Commands");
+
             auto console = Engine::GetConsole();
 
             if (console) {
-                commands.Mutex.lock();
+                const auto execute = [console](QueuedCommand &command) {
+                    console->ConsoleCommand(command.Text);
+                };
 
-                for (auto &command : commands.Queue) {
-                    console->ConsoleCommand(command.c_str());
+                for (auto i = 0; i < commands.Budget && commands.Queue.Pop(execute); ++i) {
                 }
-
-                commands.Queue.clear();
-                commands.Queue.shrink_to_fit();
-
-                commands.Mutex.unlock();
             }
         }
 
-        if (spawns.Queue.size() > 0) {
-            spawns.Mutex.lock();
+        if (!levelLoad.Loading && !spawns.Queue.Empty()) {
+            Trace::Span spawnsSpan("Spawns");
 
-            for (auto &spawn : spawns.Queue) {
-                if (!spawn.second) {
-                    spawn.second = SpawnCharacter(spawn.first);
+            const auto spawn = [](QueuedSpawn &queued) {
+                if (!*queued.Spawned) {
+                    *queued.Spawned = SpawnCharacter(queued.Character);
+
+                    if (*queued.Spawned) {
+                        Engine::WatchActor(*queued.Spawned);
+                    } else {
+                        printf("engine: failed to spawn %s\n",
+                               Characters[static_cast<int>(queued.Character)]);
+                    }
                 }
-            }
 
-            spawns.Queue.clear();
-            spawns.Queue.shrink_to_fit();
+                // Cleared after the actor is written, so its owner never sees
+                // the spawn as done without the actor
+                if (queued.Pending) {
+                    *queued.Pending = false;
+                }
+            };
 
-            spawns.Mutex.unlock();
+            for (auto i = 0; i < spawns.Budget && spawns.Queue.Pop(spawn); ++i) {
+            }
         }
     }
 
-    for (auto callback : tick.Callbacks) {
-        callback(delta);
+    for (const auto &callback : tick.Callbacks) {
+        Profiler::Call(callback.Counter, callback.Callback, delta);
     }
 
     tick.Original(scales, arg, delta);
@@ -568,6 +1084,8 @@ Classes::UTdGameEngine *Engine::GetEngine(bool update) {
     static Classes::UTdGameEngine *cache = nullptr;
 
     if (!cache || update) {
+        static const Classes::FName transient("Transient");
+
         const auto &objects = Classes::UObject::GetGlobalObjects();
         for (auto i = 0UL; i < objects.Num(); ++i) {
             const auto object = objects.GetByIndex(i);
@@ -578,7 +1096,7 @@ Classes::UTdGameEngine *Engine::GetEngine(bool update) {
                 continue;
             }
 
-            if (object->Outer->GetName() == "Transient") {
+            if (object->Outer->Name == transient) {
                 cache = static_cast<Classes::UTdGameEngine *>(object);
                 return cache;
             }
@@ -616,10 +1134,22 @@ Classes::UTdConsole *Engine::GetConsole(bool update) {
     return cache;
 }
 
-void Engine::ExecuteCommand(const wchar_t *command) {
-    commands.Mutex.lock();
-    commands.Queue.push_back(command);
-    commands.Mutex.unlock();
+bool Engine::ExecuteCommand(const wchar_t *command) {
+    // A cut command could run with different arguments, so it's rejected
+    if (wcslen(command) >= sizeof(QueuedCommand::Text) / sizeof(wchar_t)) {
+        printf("engine: command too long, rejected \"%.64ws...\"\n", command);
+        return false;
+    }
+
+    const auto queued = commands.Queue.Push([command](QueuedCommand &entry) {
+        wcscpy_s(entry.Text, command);
+    });
+
+    if (!queued) {
+        printf("engine: command queue full, dropped \"%ws\"\n", command);
+    }
+
+    return queued;
 }
 
 Classes::AWorldInfo *Engine::GetWorld(bool update) {
@@ -721,9 +1251,7 @@ Classes::ATdSPTimeTrialGame* Engine::GetTimeTrialGame(bool update)
 
         if (world) 
         {
-            std::string game = world->Game->GetName();
-
-            if (game.find("TdSPTimeTrialGame") == -1) 
+            if (!world->Game || !world->Game->IsA(Classes::ATdSPTimeTrialGame::StaticClass())) 
             {
                 cache = nullptr;
                 return cache;
@@ -752,9 +1280,7 @@ Classes::ATdSPLevelRace* Engine::GetLevelRace(bool update)
 
         if (world) 
         {
-            std::string game = world->Game->GetName();
-
-            if (game.find("TdSPLevelRace") == -1) 
+            if (!world->Game || !world->Game->IsA(Classes::ATdSPLevelRace::StaticClass())) 
             {
                 cache = nullptr;
                 return cache;
@@ -768,13 +1294,34 @@ Classes::ATdSPLevelRace* Engine::GetLevelRace(bool update)
     return cache;
 }
 
-void Engine::SpawnCharacter(Character character,
-                            Classes::ASkeletalMeshActorSpawnable *&spawned) {
+bool Engine::SpawnCharacter(Character character,
+                            Classes::ASkeletalMeshActorSpawnable *&spawned,
+                            bool *pending) {
     spawned = nullptr;
 
-    spawns.Mutex.lock();
-    spawns.Queue.push_back({character, spawned});
-    spawns.Mutex.unlock();
+    // Set before pushing, the game thread may run the spawn right away
+    if (pending) {
+        *pending = true;
+    }
+
+    Trace::Instant("SpawnQueued");
+
+    const auto queued = spawns.Queue.Push([&](QueuedSpawn &entry) {
+        entry.Character = character;
+        entry.Spawned = &spawned;
+        entry.Pending = pending;
+    });
+
+    if (!queued) {
+        if (pending) {
+            *pending = false;
+        }
+
+        printf("engine: spawn queue full, dropped %s\n",
+               Characters[static_cast<int>(character)]);
+    }
+
+    return queued;
 }
 
 void Engine::Despawn(Classes::ASkeletalMeshActorSpawnable *actor) {
@@ -782,47 +1329,85 @@ void Engine::Despawn(Classes::ASkeletalMeshActorSpawnable *actor) {
         return;
     }
 
+    UnwatchActor(actor);
+
+    if (actor->SkeletalMeshComponent) {
+        UnsubscribeBonesTick(actor->SkeletalMeshComponent);
+    }
+
     actor->ShutDown();
 }
 
+void Engine::WatchActor(Classes::AActor *actor) {
+    const auto index = static_cast<size_t>(actor->ObjectInternalInteger);
+    if (index / 32 < ActorWatchWords) {
+        actorTick.Watched[index / 32].fetch_or(1u << (index % 32),
+                                               std::memory_order_relaxed);
+    }
+}
+
+void Engine::UnwatchActor(Classes::AActor *actor) {
+    const auto index = static_cast<size_t>(actor->ObjectInternalInteger);
+    if (index / 32 < ActorWatchWords) {
+        actorTick.Watched[index / 32].fetch_and(~(1u << (index % 32)),
+                                                std::memory_order_relaxed);
+    }
+}
+
 void Engine::TransformBones(Character character,
                             Classes::TArray<Classes::FBoneAtom> *destBones,
                             Classes::FBoneAtom *src) {
 
+    const auto &table = retarget.Tables[static_cast<int>(character)];
+
     const auto dest = destBones->Buffer();
-    const auto destCount = destBones->Num();
+    if (!dest || destBones->Num() != table.BoneCount) {
+        return;
+    }
 
-    switch (character) {
-    case Character::Faith:
-    case Character::Ghost:
-        memcpy(dest, src, PLAYER_PAWN_BONE_COUNT * sizeof(Classes::FBoneAtom));
-        break;
-    case Character::Kate:
-        memcpy(dest, src, 7 * sizeof(Classes::FBoneAtom));
-        memcpy(dest + 14, src + 14, 10 * sizeof(Classes::FBoneAtom));
-        memcpy(dest + 33, src + 39, sizeof(Classes::FBoneAtom));
-        memcpy(dest + 36, src + 42, sizeof(Classes::FBoneAtom));
-        memcpy(dest + 39, src + 45, 63 * sizeof(Classes::FBoneAtom));
-        break;
-    case Character::AssaultCeleste:
-        memcpy(dest, src, 7 * sizeof(Classes::FBoneAtom));
-        memcpy(dest + destCount - 63, src + 45, 63 * sizeof(Classes::FBoneAtom));
-        memcpy(dest + 17, src + 18, sizeof(Classes::FBoneAtom));
-        break;
-    case Character::PursuitCop:
-        memcpy(dest, src, 7 * sizeof(Classes::FBoneAtom));
-        memcpy(dest + destCount - 63, src + 45, 63 * sizeof(Classes::FBoneAtom));
-        memcpy(dest + 15, src + 18, sizeof(Classes::FBoneAtom));
-        break;
-    case Character::Miller:
-    case Character::Celeste:
-    case Character::Jacknife:
-    case Character::Kreeg:
-        memcpy(dest, src, 7 * sizeof(Classes::FBoneAtom));
-        memcpy(dest + destCount - 63, src + 45, 63 * sizeof(Classes::FBoneAtom));
-        memcpy(dest + 18, src + 18, sizeof(Classes::FBoneAtom));
-        break;
+    for (const auto &run : table.Runs) {
+        memcpy(dest + run.Dest, src + run.Source,
+               run.Count * sizeof(Classes::FBoneAtom));
+    }
+}
+
+int Engine::GetBoneIndex(Classes::USkeletalMeshComponent *component,
+                         const Classes::FName &bone) {
+
+    if (!component->SkeletalMesh) {
+        return -1;
+    }
+
+    auto &bones = boneIndices.Meshes[component->SkeletalMesh];
+    for (const auto &entry : bones) {
+        if (entry.first == bone) {
+            return entry.second;
+        }
     }
+
+    const auto index = component->MatchRefBone(bone);
+    bones.emplace_back(bone, index);
+
+    return index;
+}
+
+bool Engine::GetBoneLocation(Classes::USkeletalMeshComponent *component,
+                             int index, Classes::FVector &location) {
+
+    if (index < 0 || !component->SpaceBases.IsValidIndex(index)) {
+        return false;
+    }
+
+    // The bone's component space origin, moved into world space
+    const auto &bone = component->SpaceBases[index].WPlane;
+    const auto &m = component->LocalToWorld;
+
+    location = {
+        bone.X * m.XPlane.X + bone.Y * m.YPlane.X + bone.Z * m.ZPlane.X + m.WPlane.X,
+        bone.X * m.XPlane.Y + bone.Y * m.YPlane.Y + bone.Z * m.ZPlane.Y + m.WPlane.Y,
+        bone.X * m.XPlane.Z + bone.Y * m.YPlane.Z + bone.Z * m.ZPlane.Z + m.WPlane.Z};
+
+    return true;
 }
 
 // Define these to remove the D3DX dependency
@@ -863,11 +1448,12 @@ bool Engine::IsKeyDown(int vk) {
            window.KeysDown[vk];
 }
 
-bool Engine::WorldToScreen(IDirect3DDevice9 *device,
-                           Classes::FVector &inOutLocation) {
+static void UpdateCamera(IDirect3DDevice9 *device) {
+    camera.Valid = false;
+
     const auto controller = Engine::GetPlayerController();
-    if (!controller || !projectionTick.Matrix) {
-        return false;
+    if (!controller || !controller->PlayerCamera || !projectionTick.Matrix) {
+        return;
     }
 
     const auto fov = tanf(
@@ -889,25 +1475,119 @@ bool Engine::WorldToScreen(IDirect3DDevice9 *device,
     device->GetTransform(D3DTS_WORLD, &world);
 
     D3DXMatrixMultiply(&result, &proj, &view);
-    D3DXMatrixMultiply(&proj, &result, &world);
+    D3DXMatrixMultiply(&camera.ViewProjection, &result, &world);
+
+    camera.Width = displaySize.x;
+    camera.Height = displaySize.y;
+    camera.Valid = true;
+}
+
+bool Engine::WorldToScreen(IDirect3DDevice9 *device,
+                           Classes::FVector &inOutLocation) {
+    bool visible = false;
+    WorldToScreen(&inOutLocation, &visible, 1);
+    return visible;
+}
+
+size_t Engine::WorldToScreen(Classes::FVector *inOutLocations, bool *visible,
+                             size_t count) {
+    if (!camera.Valid) {
+        memset(visible, 0, count * sizeof(bool));
+        return 0;
+    }
 
-    D3DXVECTOR4 in(inOutLocation.X, inOutLocation.Y, inOutLocation.Z, 1), out;
-    D3DXVec4Transform(&out, &in, &proj);
+    const auto &m = camera.ViewProjection.m;
+    const auto halfWidth = camera.Width / 2.0f;
+    const auto halfHeight = camera.Height / 2.0f;
+
+    // Four points per iteration, one lane each. The matrix rows are
+    // broadcast so each output component is three multiply-adds
+    __m128 rows[4][4];
+    for (auto i = 0; i < 4; ++i) {
+        for (auto j = 0; j < 4; ++j) {
+            rows[i][j] = _mm_set1_ps(m[i][j]);
+        }
+    }
 
-    inOutLocation = {(((out.x / out.w) + 1.0f) / 2.0f) * displaySize.x,
-                     ((1.0f - (out.y / out.w)) / 2.0f) * displaySize.y, out.w};
+    const auto zero = _mm_setzero_ps();
+    const auto one = _mm_set1_ps(1.0f);
+    const auto scaleX = _mm_set1_ps(halfWidth);
+    const auto scaleY = _mm_set1_ps(halfHeight);
+
+    size_t onScreen = 0;
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        auto p = inOutLocations + i;
+
+        const auto x = _mm_setr_ps(p[0].X, p[1].X, p[2].X, p[3].X);
+        const auto y = _mm_setr_ps(p[0].Y, p[1].Y, p[2].Y, p[3].Y);
+        const auto z = _mm_setr_ps(p[0].Z, p[1].Z, p[2].Z, p[3].Z);
+
+        __m128 out[4];
+        for (auto j = 0; j < 4; ++j) {
+            out[j] = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(x, rows[0][j]), _mm_mul_ps(y, rows[1][j])),
+                _mm_add_ps(_mm_mul_ps(z, rows[2][j]), rows[3][j]));
+        }
+
+        const auto mask = _mm_movemask_ps(
+            _mm_and_ps(_mm_cmpge_ps(out[2], zero), _mm_cmpge_ps(out[3], zero)));
+
+        const auto inverseW = _mm_div_ps(one, out[3]);
+        const auto screenX =
+            _mm_mul_ps(_mm_add_ps(_mm_mul_ps(out[0], inverseW), one), scaleX);
+        const auto screenY =
+            _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(out[1], inverseW)), scaleY);
+
+        alignas(16) float sx[4], sy[4], sw[4];
+        _mm_store_ps(sx, screenX);
+        _mm_store_ps(sy, screenY);
+        _mm_store_ps(sw, out[3]);
+
+        for (auto j = 0; j < 4; ++j) {
+            p[j] = {sx[j], sy[j], sw[j]};
+            visible[i + j] = (mask >> j) & 1;
+            onScreen += visible[i + j];
+        }
+    }
+
+    for (; i < count; ++i) {
+        auto &p = inOutLocations[i];
+
+        const auto x = p.X * m[0][0] + p.Y * m[1][0] + p.Z * m[2][0] + m[3][0];
+        const auto y = p.X * m[0][1] + p.Y * m[1][1] + p.Z * m[2][1] + m[3][1];
+        const auto z = p.X * m[0][2] + p.Y * m[1][2] + p.Z * m[2][2] + m[3][2];
+        const auto w = p.X * m[0][3] + p.Y * m[1][3] + p.Z * m[2][3] + m[3][3];
+
+        p = {((x / w) + 1.0f) * halfWidth, (1.0f - (y / w)) * halfHeight, w};
+        visible[i] = !(z < 0 || w < 0);
+        onScreen += visible[i];
+    }
 
-    return !(out.z < 0 || out.w < 0);
+    return onScreen;
 }
 
 HWND Engine::GetWindow() { return window.Window; }
 
 void Engine::OnRenderScene(RenderSceneCallback callback) {
-    renderScene.Callbacks.push_back(callback);
+    renderScene.Callbacks.push_back({callback, Profiler::Register("RenderScene")});
 }
 
 void Engine::OnProcessEvent(ProcessEventCallback callback) {
-    processEvent.Callbacks.push_back(callback);
+    processEvent.Callbacks.push_back(
+        {callback, Profiler::Register("ProcessEvent")});
+}
+
+void Engine::OnProcessEvent(const char *function,
+                            ProcessEventCallback callback) {
+
+    const HookCallback<ProcessEventCallback> subscription = {
+        callback, Profiler::Register(function)};
+
+    if (!SubscribeProcessEvent(function, subscription)) {
+        processEvent.Pending.emplace_back(function, subscription);
+    }
 }
 
 void Engine::OnPreLevelLoad(LevelLoadCallback callback) {
@@ -926,24 +1606,76 @@ void Engine::OnPostDeath(DeathCallback callback) {
     death.PostCallbacks.push_back(callback);
 }
 
+void Engine::OnExit(ExitCallback callback) {
+    window.ExitCallbacks.push_back(callback);
+}
+
 void Engine::OnActorTick(ActorTickCallback callback) {
-    actorTick.Callbacks.push_back(callback);
+    actorTick.Callbacks.push_back({callback, Profiler::Register("ActorTick")});
+}
+
+void Engine::OnActorTick(const char *className, ActorTickCallback callback) {
+    actorTick.ClassCallbacks.push_back(
+        {className, Classes::UObject::FindClass(className),
+         {callback, Profiler::Register(className)}});
+
+    actorTick.ClassInterest.clear();
+}
+
+void Engine::OnWatchedActorTick(ActorTickCallback callback) {
+    actorTick.WatchedCallbacks.push_back(
+        {callback, Profiler::Register("WatchedActorTick")});
 }
 
 void Engine::OnBonesTick(BonesTickCallback callback) {
-    bonesTick.Callbacks.push_back(callback);
+    bonesTick.Callbacks.push_back({callback, Profiler::Register("BonesTick")});
+}
+
+bool Engine::OnBonesTick(Classes::USkeletalMeshComponent *component,
+                         ComponentBonesTickCallback callback) {
+
+    const auto owner = component->Owner;
+    if (!owner || !IsActorWatched(owner)) {
+        return false;
+    }
+
+    RemoveBonesSubscription(component);
+
+    const BonesSubscription subscription = {
+        component, callback, owner,
+        static_cast<size_t>(owner->ObjectInternalInteger)};
+
+    const auto buffer = component->LocalAtoms.Buffer();
+    if (buffer) {
+        bonesTick.Components[buffer] = subscription;
+    } else {
+        bonesTick.Parked.push_back(subscription);
+    }
+
+    return true;
+}
+
+void Engine::UnsubscribeBonesTick(Classes::USkeletalMeshComponent *component) {
+    if (!bonesTick.Unsubscribes.Push(
+            [component](Classes::USkeletalMeshComponent *&entry) {
+                entry = component;
+            })) {
+
+        printf("engine: bones unsubscribe queue full\n");
+    }
 }
 
 void Engine::OnTick(TickCallback callback) {
-    tick.Callbacks.push_back(callback);
+    tick.Callbacks.push_back({callback, Profiler::Register("Tick")});
 }
 
 void Engine::OnInput(InputCallback callback) {
-    window.InputCallbacks.push_back(callback);
+    window.InputCallbacks.push_back({callback, Profiler::Register("Input")});
 }
 
 void Engine::OnSuperInput(InputCallback callback) {
-    window.SuperInputCallbacks.push_back(callback);
+    window.SuperInputCallbacks.push_back(
+        {callback, Profiler::Register("SuperInput")});
 }
 
 void Engine::BlockInput(bool block) {
@@ -953,11 +1685,86 @@ void Engine::BlockInput(bool block) {
 bool Engine::Initialize() {
     void *ptr = nullptr;
 
+    // Signatures in the game image, all found in a single pass
+    enum {
+        GNamesSignature,
+        GObjectsSignature,
+        ProcessEventSignature,
+        LevelLoadSignature,
+        PreDeathSignature,
+        ActorTickSignature,
+        BonesTickSignature,
+        ProjectionTickSignature,
+        TickSignature,
+        SignatureCount
+    };
+
+    Pattern::Signature signatures[SignatureCount] = {};
+
     // GNames
-    if (!(ptr = Pattern::FindPattern("\x8B\x0D\x00\x00\x00\x00\x8B\x84\x24\x00"
-                                     "\x00\x00\x00\x8B\x04\x81",
-                                     "xx????xxx????xxx"))) {
+    signatures[GNamesSignature] = {
+        "\x8B\x0D\x00\x00\x00\x00\x8B\x84\x24\x00"
+        "\x00\x00\x00\x8B\x04\x81",
+        "xx????xxx????xxx"};
+
+    // GObjects
+    signatures[GObjectsSignature] = {
+        "\x8B\x15\x00\x00\x00\x00\x8B\x0C\xB2\x8D\x44\x24\x30",
+        "xx????xxxxxxx"};
+
+    // ProcessEvent
+    signatures[ProcessEventSignature] = {
+        "\x56\x8B\xF1\x8B\x0D\x00\x00\x00\x00\x85\xC9\x74\x09",
+        "xxxxx????xxxx"};
+
+    // LevelLoad
+    signatures[LevelLoadSignature] = {
+        "\x6A\xFF\x68\x00\x00\x00\x00\x64\xA1\x00\x00\x00\x00\x50\x81\xEC"
+        "\x00\x00\x00\x00\x53\x55\x56\x57\xA1\x00\x00\x00\x00\x33\xC4\x50"
+        "\x8D\x84\x24\x00\x00\x00\x00\x64\xA3\x00\x00\x00\x00\x8B\xE9\x89"
+        "\x6C\x24\x00\x00\xFF\x89",
+        "???????xxxxxxxxx?xxxxxxxx????xxxxxx?xxxxxxxxxxxxxx??xx"};
+
+    // PreDeath
+    signatures[PreDeathSignature] = {
+        "\x8D\x4C\x24\x10\xE8\x00\x00\x00\x00\x8B\x4C\x24\x14\x85\xC9\x7C"
+        "\x1E\x3B\xCF\x0F\x8D\x00\x00\x00\x00\x8B\x04\x8E\x8B\x40\x08\x25"
+        "\x00\x00\x00\x00\x33\xD2\x0B\xC2\x75\xD6\xE9\x00\x00\x00\x00",
+        "xxxxx????xxxxxxxxxxxx????xxxxxxx????xxxxxxx????"};
+
+    // ActorTick
+    signatures[ActorTickSignature] = {
+        "\x55\x8B\xEC\x83\xE4\xF0\x83\xEC\x38\x56\x57\x8B\x81",
+        "xxxxxxxxxxxxx"};
+
+    // BonesTick
+    signatures[BonesTickSignature] = {
+        "\xE8\x00\x00\x00\x00\x8B\x74\x24\x14\x8D\x7B\x68",
+        "x????xxxxxxx"};
 
+    // ProjectionTick
+    signatures[ProjectionTickSignature] = {
+        "\x83\xEC\x3C\xD9\x44\x24\x44",
+        "xxxxxxx"};
+
+    // Tick
+    signatures[TickSignature] = {
+        "\x83\xEC\x48\x53\x55\x56\x57\x8B\xF9\xE8\x00\x00\x00\x00\x8B\x0D"
+        "\x00\x00\x00\x00\x8B\x15\x00\x00\x00\x00\x8B\xE8",
+        "xxxxxxxxxx????xx????xx????xx"};
+
+    // The game executable doesn't change between launches, so the offsets
+    // found last time are checked before scanning again
+    const auto directory = Settings::GetDirectory();
+    if (directory.empty()) {
+        Pattern::FindPatterns(signatures, SignatureCount);
+    } else {
+        Pattern::FindPatterns(nullptr, signatures, SignatureCount,
+                              directory + "\\mmultiplayer-signatures.json");
+    }
+
+    // GNames
+    if (!(ptr = signatures[GNamesSignature].Result)) {
         MessageBoxA(nullptr, "Failed to find GNames", "Failure", MB_ICONERROR);
         return false;
     }
@@ -966,10 +1773,7 @@ bool Engine::Initialize() {
         *reinterpret_cast<void **>(reinterpret_cast<byte *>(ptr) + 2));
 
     // GObjects
-    if (!(ptr = Pattern::FindPattern(
-              "\x8B\x15\x00\x00\x00\x00\x8B\x0C\xB2\x8D\x44\x24\x30",
-              "xx????xxxxxxx"))) {
-
+    if (!(ptr = signatures[GObjectsSignature].Result)) {
         MessageBoxA(nullptr, "Failed to find GObjects", "Failure", MB_ICONERROR);
         return false;
     }
@@ -978,6 +1782,9 @@ bool Engine::Initialize() {
         reinterpret_cast<decltype(Classes::UObject::GObjects)>(
             *reinterpret_cast<void **>(reinterpret_cast<byte *>(ptr) + 2));
 
+    // Every hook below is installed with a single protection change per page
+    Hook::Batch batch;
+
     // LoadLibraryA
     Hook::TrampolineHook(LoadLibraryAHook, LoadLibraryA,
                          reinterpret_cast<void **>(&LoadLibraryAOriginal));
@@ -1019,10 +1826,7 @@ bool Engine::Initialize() {
     }
 
     // ProcessEvent
-    if (!(ptr = Pattern::FindPattern(
-              "\x56\x8B\xF1\x8B\x0D\x00\x00\x00\x00\x85\xC9\x74\x09",
-              "xxxxx????xxxx"))) {
-
+    if (!(ptr = signatures[ProcessEventSignature].Result)) {
         MessageBoxA(nullptr, "Failed to find ProcessEvent", "Failure", MB_ICONERROR);
         return false;
     }
@@ -1036,13 +1840,7 @@ bool Engine::Initialize() {
     }
 
     // LevelLoad
-    if (!(ptr = levelLoad.Base = Pattern::FindPattern(
-              "\x6A\xFF\x68\x00\x00\x00\x00\x64\xA1\x00\x00\x00\x00\x50\x81\xEC"
-              "\x00\x00\x00\x00\x53\x55\x56\x57\xA1\x00\x00\x00\x00\x33\xC4\x50"
-              "\x8D\x84\x24\x00\x00\x00\x00\x64\xA3\x00\x00\x00\x00\x8B\xE9\x89"
-              "\x6C\x24\x00\x00\xFF\x89",
-              "???????xxxxxxxxx?xxxxxxxx????xxxxxx?xxxxxxxxxxxxxx??xx"))) {
-
+    if (!(ptr = levelLoad.Base = signatures[LevelLoadSignature].Result)) {
         MessageBoxA(nullptr, "Failed to find LevelLoad", "Failure", MB_ICONERROR);
         return false;
     }
@@ -1055,12 +1853,7 @@ bool Engine::Initialize() {
     }
 
     // PreDeath
-    if (!(ptr = Pattern::FindPattern(
-              "\x8D\x4C\x24\x10\xE8\x00\x00\x00\x00\x8B\x4C\x24\x14\x85\xC9\x7C"
-              "\x1E\x3B\xCF\x0F\x8D\x00\x00\x00\x00\x8B\x04\x8E\x8B\x40\x08\x25"
-              "\x00\x00\x00\x00\x33\xD2\x0B\xC2\x75\xD6\xE9\x00\x00\x00\x00",
-              "xxxxx????xxxxxxxxxxxx????xxxxxxx????xxxxxxx????"))) {
-
+    if (!(ptr = signatures[PreDeathSignature].Result)) {
         MessageBoxA(nullptr, "Failed to find PreDeath (1)", "Failure", MB_ICONERROR);
         return false;
     }
@@ -1102,10 +1895,7 @@ bool Engine::Initialize() {
     }
 
     // ActorTick
-    if (!(ptr = Pattern::FindPattern(
-              "\x55\x8B\xEC\x83\xE4\xF0\x83\xEC\x38\x56\x57\x8B\x81",
-              "xxxxxxxxxxxxx"))) {
-
+    if (!(ptr = signatures[ActorTickSignature].Result)) {
         MessageBoxA(nullptr, "Failed to find ActorTick", "Failure", MB_ICONERROR);
         return false;
     }
@@ -1118,10 +1908,7 @@ bool Engine::Initialize() {
     }
 
     // BonesTick
-    if (!(ptr = Pattern::FindPattern(
-              "\xE8\x00\x00\x00\x00\x8B\x74\x24\x14\x8D\x7B\x68",
-              "x????xxxxxxx"))) {
-
+    if (!(ptr = signatures[BonesTickSignature].Result)) {
         MessageBoxA(nullptr, "Failed to find BonesTick", "Failure", MB_ICONERROR);
         return false;
     }
@@ -1133,9 +1920,10 @@ bool Engine::Initialize() {
         return false;
     }
 
+    bonesTick.ComponentCounter = Profiler::Register("BonesTick (component)");
+
     // ProjectionTick
-    if (!(ptr = Pattern::FindPattern("\x83\xEC\x3C\xD9\x44\x24\x44",
-                                     "xxxxxxx"))) {
+    if (!(ptr = signatures[ProjectionTickSignature].Result)) {
         MessageBoxA(nullptr, "Failed to find ProjectionTick", "Failure",
                     MB_ICONERROR);
         return false;
@@ -1151,11 +1939,7 @@ bool Engine::Initialize() {
     }
 
     // Tick
-    if (!(ptr = Pattern::FindPattern(
-              "\x83\xEC\x48\x53\x55\x56\x57\x8B\xF9\xE8\x00\x00\x00\x00\x8B\x0D"
-              "\x00\x00\x00\x00\x8B\x15\x00\x00\x00\x00\x8B\xE8",
-              "xxxxxxxxxx????xx????xx????xx"))) {
-
+    if (!(ptr = signatures[TickSignature].Result)) {
         MessageBoxA(nullptr, "Failed to find Tick", "Failure", MB_ICONERROR);
         return false;
     }
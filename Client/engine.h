@@ -14,8 +14,12 @@ typedef bool (*ProcessEventCallback)(Classes::UObject *, Classes::UFunction *,
                                      void *, void *);
 typedef void (*LevelLoadCallback)(const wchar_t *levelName);
 typedef void (*DeathCallback)();
+typedef void (*ExitCallback)();
 typedef void (*ActorTickCallback)(Classes::AActor *actor);
 typedef void (*BonesTickCallback)(Classes::TArray<Classes::FBoneAtom> *atoms);
+typedef void (*ComponentBonesTickCallback)(
+    Classes::USkeletalMeshComponent *component,
+    Classes::TArray<Classes::FBoneAtom> *atoms);
 typedef void (*TickCallback)(float delta);
 typedef void (*InputCallback)(unsigned int &message, int keycode);
 
@@ -49,30 +53,94 @@ enum class Character {
 Classes::UTdGameEngine *GetEngine(bool update = false);
 Classes::UTdGameViewportClient *GetViewportClient(bool update = false);
 Classes::UTdConsole *GetConsole(bool update = false);
-void ExecuteCommand(const wchar_t *command);
+// Queues a console command for the game thread. Returns false if it was
+// rejected for being too long or the queue was full
+bool ExecuteCommand(const wchar_t *command);
 Classes::AWorldInfo *GetWorld(const bool update = false);
 Classes::ATdPlayerController *GetPlayerController(bool update = false);
 Classes::ATdPlayerPawn *GetPlayerPawn(bool update = false);
 Classes::ATdSPTimeTrialGame *GetTimeTrialGame(bool update = false);
 Classes::ATdSPLevelRace *GetLevelRace(bool update = false);
-void SpawnCharacter(Character character,
-                    Classes::ASkeletalMeshActorSpawnable *&spawned);
+// Queues a spawn that writes the actor to spawned on the game thread. Returns
+// false if the queue was full. If given, pending is set while the spawn is
+// queued and cleared once it ran, failed or was dropped by a level load
+bool SpawnCharacter(Character character,
+                    Classes::ASkeletalMeshActorSpawnable *&spawned,
+                    bool *pending = nullptr);
 void Despawn(Classes::ASkeletalMeshActorSpawnable *actor);
 void TransformBones(Character character,
                     Classes::TArray<Classes::FBoneAtom> *dest,
                     Classes::FBoneAtom *src);
 
+// Resolves a bone name to its index in the component's skeleton, once per
+// mesh. Returns -1 if the skeleton has no such bone. Game thread only
+int GetBoneIndex(Classes::USkeletalMeshComponent *component,
+                 const Classes::FName &bone);
+
+// Reads a bone's world location from the component's last evaluated pose,
+// without calling into script. Returns false if the bone isn't posed
+bool GetBoneLocation(Classes::USkeletalMeshComponent *component, int index,
+                     Classes::FVector &location);
+
 bool IsKeyDown(int);
+// Projects a world location to screen space using the camera captured at the
+// start of the current render frame. The result's Z is the view depth
 bool WorldToScreen(IDirect3DDevice9 *device, Classes::FVector &inOutLocation);
+
+// Projects count locations in place and marks which of them are in front of
+// the camera. Returns the number of visible locations. Render thread only
+size_t WorldToScreen(Classes::FVector *inOutLocations, bool *visible,
+                     size_t count);
+
 HWND GetWindow();
 void OnRenderScene(RenderSceneCallback callback);
+
+// Adds a wildcard process event callback, called for every event the engine
+// fires. Prefer subscribing to the functions the callback handles.
 void OnProcessEvent(ProcessEventCallback callback);
+
+// Adds a process event callback for a single function, e.g.
+// "Function TdGame.TdPawn.Died". Other events skip the callback entirely.
+void OnProcessEvent(const char *function, ProcessEventCallback callback);
+
 void OnPreLevelLoad(LevelLoadCallback callback);
 void OnPostLevelLoad(LevelLoadCallback callback);
 void OnPreDeath(DeathCallback callback);
 void OnPostDeath(DeathCallback callback);
+
+// Called when the game window is destroyed as the game exits, while every
+// thread is still running. Unlike DLL_PROCESS_DETACH, locks can be taken
+void OnExit(ExitCallback callback);
+
+// Adds a wildcard actor tick callback, called for every ticking actor in the
+// world. Prefer the filtered variants below.
 void OnActorTick(ActorTickCallback callback);
+
+// Adds an actor tick callback for actors of a class or its subclasses, e.g.
+// "Class TdGame.TdPawn".
+void OnActorTick(const char *className, ActorTickCallback callback);
+
+// Adds an actor tick callback for watched actors only. Characters spawned with
+// SpawnCharacter are watched until despawned or the level changes.
+void OnWatchedActorTick(ActorTickCallback callback);
+void WatchActor(Classes::AActor *actor);
+void UnwatchActor(Classes::AActor *actor);
+
+// Adds a wildcard bones tick callback, called for every skeletal mesh that
+// updates its bones. Prefer subscribing to the components of interest.
 void OnBonesTick(BonesTickCallback callback);
+
+// Subscribes a component to a bones tick callback, replacing its previous one.
+// Game thread only. Returns false if the component's owner isn't watched. The
+// subscription survives the component releasing and reallocating its bones,
+// and ends on UnsubscribeBonesTick, Despawn, UnwatchActor or a level load, so
+// callers subscribe once per spawned actor.
+bool OnBonesTick(Classes::USkeletalMeshComponent *component,
+                 ComponentBonesTickCallback callback);
+
+// Can be called from any thread. Takes effect on the next tick
+void UnsubscribeBonesTick(Classes::USkeletalMeshComponent *component);
+
 void OnTick(TickCallback callback);
 
 // Adds a standard input callback. Will not trigger if the menu is blocking
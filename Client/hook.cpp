@@ -1,4 +1,7 @@
+#include <vector>
+
 #include "hook.h"
+#include "trampoline.h"
 
 static byte INSTRUCTION_TABLE_00[] = { 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3, 3, 7, 3, 3, };
 static byte INSTRUCTION_TABLE_01[] = { 2, 2, 2, 2, 16, 6, 2, 2, 2, 2, 2, 2, 16, 6, 2, 2, 2, 2, 2, 2, 16, 6, 2, 2, 2, 2, 2, 2, 16, 6, 2, 2, 2, 2, 2, 2, 16, 6, 2, 2, 2, 2, 2, 2, 16, 6, 2, 2, 2, 2, 2, 2, 16, 6, 2, 2, 2, 2, 2, 2, 16, 6, 2, 2, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, };
@@ -124,11 +127,107 @@ byte Hook::GetInstructionLength(byte table[], byte *instruction) {
 	return i < 0x10 ? i : GetInstructionLength(INSTRUCTION_TABLES[i - 0x10], instruction);
 }
 
+// Trampolines are carved out of shared executable pages instead of taking an
+// allocation granule each. Every address of a 32-bit process is within rel32
+// reach, so any pool page is near enough to its target
+static void *AllocatePoolPage(size_t size) {
+	return VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+}
+
+static Hook::TrampolinePool pool(32, 0x10000, AllocatePoolPage);
+
+// Pages made writable by the current thread's batch, with their original
+// protection
+static thread_local struct {
+	int Depth = 0;
+	std::vector<std::pair<byte *, DWORD>> Pages;
+} batch;
+
+static byte *AllocateTrampoline(size_t size) {
+	return static_cast<byte *>(pool.Allocate(size));
+}
+
+static void FreeTrampoline(void *trampoline) {
+	pool.Free(trampoline);
+}
+
+static size_t GetPageSize() {
+	static const auto size = [] {
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+
+		return static_cast<size_t>(info.dwPageSize);
+	}();
+
+	return size;
+}
+
+// Makes code writable. Inside a batch each page is only changed once and
+// restored when the batch ends
+static bool Unprotect(void *address, size_t size, DWORD &protection) {
+	if (!batch.Depth) {
+		return VirtualProtect(address, size, PAGE_EXECUTE_READWRITE, &protection) != FALSE;
+	}
+
+	const auto pageSize = GetPageSize();
+
+	const auto mask = ~static_cast<uintptr_t>(pageSize - 1);
+	const auto first = reinterpret_cast<uintptr_t>(address) & mask;
+	const auto last = (reinterpret_cast<uintptr_t>(address) + size - 1) & mask;
+
+	for (auto page = first; page <= last; page += pageSize) {
+		auto unprotected = false;
+		for (const auto &entry : batch.Pages) {
+			if (entry.first == reinterpret_cast<byte *>(page)) {
+				unprotected = true;
+				break;
+			}
+		}
+
+		if (unprotected) {
+			continue;
+		}
+
+		DWORD original = 0;
+		if (!VirtualProtect(reinterpret_cast<void *>(page), pageSize, PAGE_EXECUTE_READWRITE, &original)) {
+			return false;
+		}
+
+		batch.Pages.emplace_back(reinterpret_cast<byte *>(page), original);
+	}
+
+	return true;
+}
+
+static void Protect(void *address, size_t size, DWORD protection) {
+	if (!batch.Depth) {
+		VirtualProtect(address, size, protection, &protection);
+		FlushInstructionCache(GetCurrentProcess(), address, size);
+	}
+}
+
+Hook::Batch::Batch() {
+	++batch.Depth;
+}
+
+Hook::Batch::~Batch() {
+	if (--batch.Depth) {
+		return;
+	}
+
+	for (auto &entry : batch.Pages) {
+		VirtualProtect(entry.first, 1, entry.second, &entry.second);
+	}
+
+	batch.Pages.clear();
+	FlushInstructionCache(GetCurrentProcess(), nullptr, 0);
+}
+
 bool Hook::SetJMP(void *dest, void *src, int nops) {
 	byte jmp[] = { 0xE9, 0x00, 0x00, 0x00, 0x00 };
 
 	DWORD protection = 0;
-	if (!VirtualProtect(src, JMP_SIZE + nops, PAGE_EXECUTE_READWRITE, &protection)) {
+	if (!Unprotect(src, JMP_SIZE + nops, protection)) {
 		return false;
 	}
 
@@ -139,7 +238,7 @@ bool Hook::SetJMP(void *dest, void *src, int nops) {
 		*(static_cast<byte *>(src) + JMP_SIZE + i) = 0x90;
 	}
 
-	VirtualProtect(src, JMP_SIZE + nops, protection, &protection);
+	Protect(src, JMP_SIZE + nops, protection);
 	return true;
 }
 
@@ -149,13 +248,13 @@ bool Hook::TrampolineHook(void *dest, void *src, void **original) {
 	}
 
 	if (*static_cast<byte *>(src) == 0xE9) {
-		void *copy = VirtualAlloc(nullptr, JMP_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+		void *copy = AllocateTrampoline(JMP_SIZE);
 		if (!copy) {
 			return false;
 		}
 
 		if (!SetJMP(RELATIVE_ADDR(src, JMP_SIZE), copy, 0)) {
-			VirtualFree(copy, 0, MEM_RELEASE);
+			FreeTrampoline(copy);
 			return false;
 		}
 
@@ -168,7 +267,7 @@ bool Hook::TrampolineHook(void *dest, void *src, void **original) {
 				*original = nullptr;
 			}
 
-			VirtualFree(copy, 0, MEM_RELEASE);
+			FreeTrampoline(copy);
 			return false;
 		}
 	} else {
@@ -187,14 +286,14 @@ bool Hook::TrampolineHook(void *dest, void *src, void **original) {
 			}
 		}
 
-		auto copy = static_cast<byte *>(VirtualAlloc(nullptr, length + JMP_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE));
+		auto copy = AllocateTrampoline(length + JMP_SIZE);
 		if (!copy) {
 			return false;
 		}
 
 		memcpy(copy, src, length);
 		if (!SetJMP(static_cast<byte *>(src) + length, copy + length, 0)) {
-			VirtualFree(copy, 0, MEM_RELEASE);
+			FreeTrampoline(copy);
 			return false;
 		}
 
@@ -207,7 +306,7 @@ bool Hook::TrampolineHook(void *dest, void *src, void **original) {
 				*original = nullptr;
 			}
 
-			VirtualFree(copy, 0, MEM_RELEASE);
+			FreeTrampoline(copy);
 			return false;
 		}
 	}
@@ -228,14 +327,14 @@ bool Hook::UnTrampolineHook(void *src, void *original) {
 	}
 
 	DWORD protection = 0;
-	if (!VirtualProtect(src, length, PAGE_EXECUTE_READWRITE, &protection)) {
+	if (!Unprotect(src, length, protection)) {
 		return false;
 	}
 
 	memcpy(src, original, length);
 
-	VirtualProtect(src, length, protection, &protection);
-	VirtualFree(original, 0, MEM_RELEASE);
+	Protect(src, length, protection);
+	FreeTrampoline(original);
 
 	original = nullptr;
 	return true;
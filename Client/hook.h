@@ -14,4 +14,16 @@ bool SetJMP(void *dest, void *src, int nops);
 bool TrampolineHook(void *dest, void *src, void **original = nullptr);
 bool UnTrampolineHook(void *src, void *original);
 
+// While alive, pages patched by this thread stay writable and have their
+// protection restored once when the outermost batch ends, so installing or
+// removing many hooks doesn't flip the same pages over and over
+class Batch {
+public:
+	Batch();
+	~Batch();
+
+	Batch(const Batch &) = delete;
+	Batch &operator=(const Batch &) = delete;
+};
+
 }; // namespace Hook
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "intern.h"
+
+struct Table {
+    std::shared_mutex Mutex;
+
+    // A deque never moves its elements, so the map can key on views of them
+    std::deque<std::string> Strings = {std::string()};
+    std::unordered_map<std::string_view, Intern::Id> Ids = {{Strings[0], 0}};
+};
+
+// Created on first use, so other static initializers can intern, and leaked
+// so it outlives any thread still interning during shutdown
+static Table &GetTable() {
+    static const auto table = new Table();
+    return *table;
+}
+
+Intern::Id Intern::Get(const std::string &value) {
+    auto &table = GetTable();
+
+    {
+        std::shared_lock<std::shared_mutex> lock(table.Mutex);
+
+        const auto it = table.Ids.find(value);
+        if (it != table.Ids.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(table.Mutex);
+
+    const auto it = table.Ids.find(value);
+    if (it != table.Ids.end()) {
+        return it->second;
+    }
+
+    const auto id = static_cast<Id>(table.Strings.size());
+    table.Strings.push_back(value);
+    table.Ids.emplace(table.Strings.back(), id);
+
+    return id;
+}
+
+Intern::Id Intern::Find(const std::string &value) {
+    auto &table = GetTable();
+
+    std::shared_lock<std::shared_mutex> lock(table.Mutex);
+
+    const auto it = table.Ids.find(value);
+    return it != table.Ids.end() ? it->second : 0;
+}
+
+const std::string &Intern::Name(Id id) {
+    auto &table = GetTable();
+
+    std::shared_lock<std::shared_mutex> lock(table.Mutex);
+    return id < table.Strings.size() ? table.Strings[id] : table.Strings[0];
+}
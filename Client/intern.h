@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+
+namespace Intern {
+
+// Small integer standing in for a string. Equal strings always get the same
+// id, and ids stay valid for the lifetime of the process. 0 is the empty string
+typedef unsigned int Id;
+
+// Returns the id of value, assigning a new one the first time it's seen.
+// Safe to call from any thread
+Id Get(const std::string &value);
+
+// Returns the id of value if it has been assigned one, otherwise 0. Never adds
+// to the table. Safe to call from any thread
+Id Find(const std::string &value);
+
+// Returns the string an id was assigned to. The reference stays valid
+const std::string &Name(Id id);
+
+} // namespace Intern
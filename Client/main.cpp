@@ -2,6 +2,7 @@
 
 #include "debug.h"
 #include "menu.h"
+#include "profiler.h"
 #include "settings.h"
 #include "addon.h"
 
@@ -28,21 +29,42 @@ BOOL APIENTRY DllMain(HMODULE module, DWORD reason, LPVOID reserved) {
             goto CLEANUP;
         }
 
+        // The process exit kills the flusher before DLL_PROCESS_DETACH, write
+        // the last changes while the game is still shutting down
+        Engine::OnExit(Settings::Flush);
+
+        Profiler::SetOwner("Menu");
+
         if (!Menu::Initialize()) {
             MessageBoxA(nullptr, "Failed to initialize menu", "Fatal", 0);
             goto CLEANUP;
         }
 		
         for (auto &addon : addons) {
+            Profiler::SetOwner(addon->GetName().c_str());
+
             if (!addon->Initialize()) {
                 MessageBoxA(nullptr, ("Failed to initialize \"" + addon->GetName() + "\"").c_str(), "Fatal", 0);
             }
         }
+
+        Profiler::SetOwner("Engine");
+
+        if (!Profiler::Initialize()) {
+            MessageBoxA(nullptr, "Failed to initialize profiler", "Failure", 0);
+        }
 	
         CLEANUP:
             for (const auto addon: addons) {
                 delete addon;
             }
+    } else if (reason == DLL_PROCESS_DETACH) {
+        // Settings are written behind, don't lose the last changes. When the
+        // process is exiting the other threads are already gone, possibly
+        // holding the settings lock, OnExit flushed them instead
+        if (!reserved) {
+            Settings::Flush();
+        }
     }
 	return TRUE;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <locale>
 #include <d3d9.h>
 
+#include "arena.h"
 #include "debug.h"
 #include "engine.h"
 #include "settings.h"
@@ -66,11 +67,9 @@ static void EngineTab()
 
 	auto commandInputCallback = []() 
 	{
-		if (command[0]) 
+		// Left in the box if it was rejected, so it can be fixed or sent again
+		if (command[0] && Engine::ExecuteCommand(ConvertUtf8ToWideString(command).c_str())) 
 		{
-		    
-			Engine::ExecuteCommand(ConvertUtf8ToWideString(command).c_str());
-
 			command[0] = 0;
 		}
 	};
@@ -157,7 +156,7 @@ static void WorldTab()
 			if (level) 
 			{
 				bool check = level->bShouldBeLoaded;
-				auto label = level->PackageName.GetName();
+				auto label = Arena::GetName(level->PackageName);
 
 				if (level->bHasLoadRequestPending || level->bHasUnloadRequestPending) 
 				{
@@ -1,17 +1,11 @@
 #include <windows.h>
 #include <psapi.h>
 
-#include "pattern.h"
+#include <fstream>
+#include <vector>
 
-bool Pattern::CheckMask(void *base, const char *pattern, const char *mask) {
-	for (auto b = reinterpret_cast<char *>(base); *mask; ++b, ++pattern, ++mask) {
-		if ('x' == *mask && *b != *pattern) {
-			return false;
-		}
-	}
-
-	return base != nullptr;
-}
+#include "json.h"
+#include "pattern.h"
 
 void *Pattern::FindPattern(const char *pattern, const char *mask) {
 	return FindPattern(nullptr, pattern, mask);
@@ -31,15 +25,159 @@ void *Pattern::FindPattern(const char *module, const char *pattern, const char *
 	return nullptr;
 }
 
-void *Pattern::FindPattern(void *base, int size, const char *pattern, const char *mask) {
-	size -= strlen(mask);
+bool Pattern::FindPatterns(Signature *signatures, size_t count) {
+	return FindPatterns(nullptr, signatures, count);
+}
+
+bool Pattern::FindPatterns(const char *module, Signature *signatures, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		signatures[i].Result = nullptr;
+	}
+
+	auto mod = GetModuleHandleA(module);
+	if (!mod) {
+		return false;
+	}
+
+	MODULEINFO info = { nullptr };
+	if (GetModuleInformation(GetCurrentProcess(), mod, &info, sizeof(info))) {
+		return FindPatterns(mod, info.SizeOfImage, signatures, count);
+	}
+
+	return false;
+}
+
+static unsigned long long Hash(const void *data, size_t size, unsigned long long hash = 0xCBF29CE484222325ULL) {
+	for (auto b = reinterpret_cast<const unsigned char *>(data); size--; ++b) {
+		hash = (hash ^ *b) * 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+
+// Identifies a build of the module. Only fields the loader leaves alone are
+// hashed, ImageBase is rewritten when the module is relocated
+static unsigned long long HashModule(HMODULE module) {
+	const auto dos = reinterpret_cast<const IMAGE_DOS_HEADER *>(module);
+	const auto nt = reinterpret_cast<const IMAGE_NT_HEADERS *>(reinterpret_cast<const char *>(module) + dos->e_lfanew);
+	const auto &optional = nt->OptionalHeader;
+
+	auto hash = Hash(&nt->FileHeader, sizeof(nt->FileHeader));
+	hash = Hash(&optional.AddressOfEntryPoint, sizeof(optional.AddressOfEntryPoint), hash);
+	hash = Hash(&optional.SizeOfCode, sizeof(optional.SizeOfCode), hash);
+	hash = Hash(&optional.SizeOfImage, sizeof(optional.SizeOfImage), hash);
+	hash = Hash(&optional.CheckSum, sizeof(optional.CheckSum), hash);
+
+	return Hash(IMAGE_FIRST_SECTION(nt), nt->FileHeader.NumberOfSections * sizeof(IMAGE_SECTION_HEADER), hash);
+}
+
+static std::string ToHex(unsigned long long value) {
+	char hex[17];
+	sprintf_s(hex, sizeof(hex), "%016llx", value);
+
+	return hex;
+}
+
+static std::string SignatureKey(const Pattern::Signature &signature) {
+	const auto length = strlen(signature.Mask);
+	return ToHex(Hash(signature.Pattern, length, Hash(signature.Mask, length)));
+}
+
+// Returns the cached offsets for this build of the module, or an empty cache if
+// the file is missing, unreadable or from another build
+static json LoadCache(const std::string &cachePath, const std::string &moduleKey) {
+	try {
+		if (auto file = std::ifstream(cachePath)) {
+			auto cache = json::parse(file);
 
-	for (int i = 0; i <= size; ++i) {
-		auto addr = reinterpret_cast<char *>(base) + i;
-		if (CheckMask(addr, pattern, mask)) {
-			return addr;
+			if (cache.is_object() && cache.value("module", "") == moduleKey && cache.at("signatures").is_object()) {
+				return cache;
+			}
+		}
+	} catch (const json::exception &) {}
+
+	return { { "module", moduleKey }, { "signatures", json::object() } };
+}
+
+// Written to a temporary file first like the settings, so a crash mid-write
+// can't leave a truncated cache behind
+static bool SaveCache(const std::string &cachePath, const json &cache) {
+	const auto temporaryPath = cachePath + ".tmp";
+	const auto dump = cache.dump();
+
+	std::ofstream file(temporaryPath, std::ios::out | std::ios::binary);
+	if (file) {
+		file.write(dump.c_str(), dump.size());
+		file.close();
+
+		if (file && MoveFileExA(temporaryPath.c_str(), cachePath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+			return true;
 		}
 	}
 
-	return nullptr;
+	DeleteFileA(temporaryPath.c_str());
+	return false;
+}
+
+bool Pattern::FindPatterns(const char *module, Signature *signatures, size_t count, const std::string &cachePath) {
+	for (size_t i = 0; i < count; ++i) {
+		signatures[i].Result = nullptr;
+	}
+
+	auto mod = GetModuleHandleA(module);
+	MODULEINFO info = { nullptr };
+
+	if (!mod || !GetModuleInformation(GetCurrentProcess(), mod, &info, sizeof(info))) {
+		return false;
+	}
+
+	const auto base = reinterpret_cast<char *>(mod);
+	const auto size = static_cast<int>(info.SizeOfImage);
+	const auto moduleKey = ToHex(HashModule(mod));
+
+	auto cache = LoadCache(cachePath, moduleKey);
+	auto &offsets = cache["signatures"];
+
+	// Cached offsets are trusted only if the signature still matches there
+	std::vector<Signature> missing;
+	std::vector<size_t> missingIndices;
+
+	for (size_t i = 0; i < count; ++i) {
+		auto &signature = signatures[i];
+		const auto entry = offsets.find(SignatureKey(signature));
+
+		if (entry != offsets.end() && entry->is_number_integer()) {
+			const auto offset = entry->get<long long>();
+			const auto length = static_cast<long long>(strlen(signature.Mask));
+
+			if (offset >= 0 && offset <= size - length && CheckMask(base + offset, signature.Pattern, signature.Mask)) {
+				signature.Result = base + offset;
+				continue;
+			}
+		}
+
+		missing.push_back(signature);
+		missingIndices.push_back(i);
+	}
+
+	if (missing.empty()) {
+		return true;
+	}
+
+	const auto found = FindPatterns(base, size, missing.data(), missing.size());
+
+	for (size_t i = 0; i < missing.size(); ++i) {
+		const auto &signature = missing[i];
+		signatures[missingIndices[i]].Result = signature.Result;
+
+		if (signature.Result) {
+			offsets[SignatureKey(signature)] = reinterpret_cast<char *>(signature.Result) - base;
+		}
+	}
+
+	// The signatures were found either way, an unsaved cache only costs the
+	// next launch a full scan
+	SaveCache(cachePath, cache);
+
+	return found;
 }
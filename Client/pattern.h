@@ -2,11 +2,22 @@
 
 #include <Windows.h>
 
+#include <string>
+
+#include "scanner.h"
+
 namespace Pattern {
 
-bool CheckMask(void *base, const char *pattern, const char *mask);
 void *FindPattern(const char *pattern, const char *mask);
 void *FindPattern(const char *module, const char *pattern, const char *mask);
-void *FindPattern(void *base, int size, const char *pattern, const char *mask);
+
+// FindPatterns over a loaded module's image, the main executable by default
+bool FindPatterns(Signature *signatures, size_t count);
+bool FindPatterns(const char *module, Signature *signatures, size_t count);
+
+// Same as FindPatterns, but first checks the module-relative offsets that a
+// previous run saved to cachePath. The cache only applies to a module with the
+// same headers, and only signatures that no longer match are scanned for
+bool FindPatterns(const char *module, Signature *signatures, size_t count, const std::string &cachePath);
 
 }; // namespace Pattern
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include <windows.h>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <string>
+
+#include "imgui/imgui.h"
+#include "menu.h"
+#include "profiler.h"
+#include "settings.h"
+#include "trace.h"
+
+static const int SampleCount = 512;
+static const int BucketCount = 32;
+
+struct Profiler::Counter {
+    std::string Owner;
+    std::string Hook;
+    unsigned long long Calls = 0;
+
+    // Durations of the most recent calls in microseconds
+    float Samples[SampleCount] = {0};
+};
+
+bool Profiler::Enabled = false;
+
+static struct {
+    // Deque so counters never move once handed out
+    std::deque<Profiler::Counter> Counters;
+    std::string Owner = "Engine";
+    std::mutex Mutex;
+    double MicrosecondsPerTick = 0;
+    int Selected = -1;
+} profiler;
+
+Profiler::Counter *Profiler::Register(const char *hook) {
+    std::lock_guard<std::mutex> lock(profiler.Mutex);
+
+    profiler.Counters.emplace_back();
+
+    auto &counter = profiler.Counters.back();
+    counter.Owner = profiler.Owner;
+    counter.Hook = hook;
+
+    return &counter;
+}
+
+void Profiler::SetOwner(const char *owner) {
+    std::lock_guard<std::mutex> lock(profiler.Mutex);
+    profiler.Owner = owner;
+}
+
+long long Profiler::Now() {
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+
+    return now.QuadPart;
+}
+
+void Profiler::Record(Counter *counter, long long start) {
+    const auto elapsed = Now() - start;
+
+    counter->Samples[counter->Calls++ % SampleCount] =
+        static_cast<float>(elapsed * profiler.MicrosecondsPerTick);
+}
+
+static void PerformanceTab() {
+    ImGui::Checkbox("Enabled##profiler-enabled", &Profiler::Enabled);
+    ImGui::SameLine();
+
+    if (ImGui::Button("Reset##profiler-reset")) {
+        for (auto &counter : profiler.Counters) {
+            counter.Calls = 0;
+        }
+    }
+
+    ImGui::Checkbox("Trace##profiler-trace", &Trace::Enabled);
+    ImGui::SameLine();
+
+    static std::string tracePath;
+    if (ImGui::Button("Save Trace##profiler-save-trace")) {
+        SYSTEMTIME time;
+        GetLocalTime(&time);
+
+        char name[MAX_PATH];
+        sprintf_s(name, sizeof(name),
+                  "\\mmultiplayer-trace-%04d%02d%02d-%02d%02d%02d.json",
+                  time.wYear, time.wMonth, time.wDay, time.wHour,
+                  time.wMinute, time.wSecond);
+
+        tracePath = Settings::GetDirectory() + name;
+        if (!Trace::Flush(tracePath)) {
+            tracePath.clear();
+        }
+    }
+
+    if (!tracePath.empty()) {
+        ImGui::TextUnformatted(tracePath.c_str());
+    }
+
+    ImGui::Separator(5.0f);
+
+    static float sorted[SampleCount];
+    static float buckets[BucketCount];
+
+    if (!ImGui::BeginTable("##profiler-counters", 6,
+                           ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                               ImGuiTableFlags_SizingStretchProp)) {
+        return;
+    }
+
+    ImGui::TableSetupColumn("Addon");
+    ImGui::TableSetupColumn("Hook");
+    ImGui::TableSetupColumn("Calls");
+    ImGui::TableSetupColumn("Min (us)");
+    ImGui::TableSetupColumn("Avg (us)");
+    ImGui::TableSetupColumn("P99 (us)");
+    ImGui::TableHeadersRow();
+
+    std::lock_guard<std::mutex> lock(profiler.Mutex);
+
+    for (auto i = 0; i < static_cast<int>(profiler.Counters.size()); ++i) {
+        const auto &counter = profiler.Counters[i];
+        const auto count = static_cast<int>(
+            std::min<unsigned long long>(counter.Calls, SampleCount));
+
+        std::copy(counter.Samples, counter.Samples + count, sorted);
+        std::sort(sorted, sorted + count);
+
+        auto sum = 0.0f;
+        for (auto j = 0; j < count; ++j) {
+            sum += sorted[j];
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+
+        ImGui::PushID(i);
+        if (ImGui::Selectable(counter.Owner.c_str(), profiler.Selected == i,
+                              ImGuiSelectableFlags_SpanAllColumns)) {
+
+            profiler.Selected = profiler.Selected == i ? -1 : i;
+        }
+        ImGui::PopID();
+
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(counter.Hook.c_str());
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", counter.Calls);
+
+        if (count == 0) {
+            continue;
+        }
+
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", sorted[0]);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", sum / count);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", sorted[(count - 1) * 99 / 100]);
+    }
+
+    ImGui::EndTable();
+
+    if (profiler.Selected < 0 ||
+        profiler.Selected >= static_cast<int>(profiler.Counters.size())) {
+        return;
+    }
+
+    // Distribution of the recent calls of the selected callback
+    const auto &counter = profiler.Counters[profiler.Selected];
+    const auto count = static_cast<int>(
+        std::min<unsigned long long>(counter.Calls, SampleCount));
+
+    if (count == 0) {
+        return;
+    }
+
+    const auto range = std::minmax_element(counter.Samples, counter.Samples + count);
+    const auto low = *range.first;
+    const auto width = std::max((*range.second - low) / BucketCount, 0.001f);
+
+    std::fill(buckets, buckets + BucketCount, 0.0f);
+    for (auto j = 0; j < count; ++j) {
+        const auto bucket = static_cast<int>((counter.Samples[j] - low) / width);
+        ++buckets[std::min(bucket, BucketCount - 1)];
+    }
+
+    char overlay[64];
+    sprintf_s(overlay, sizeof(overlay), "%.2f - %.2f us", low, *range.second);
+
+    ImGui::Separator(5.0f);
+    ImGui::PlotHistogram("##profiler-histogram", buckets, BucketCount, 0,
+                         overlay, 0.0f, FLT_MAX, ImVec2(-1.0f, 80.0f));
+}
+
+bool Profiler::Initialize() {
+    LARGE_INTEGER frequency;
+    if (!QueryPerformanceFrequency(&frequency)) {
+        return false;
+    }
+
+    profiler.MicrosecondsPerTick = 1000000.0 / frequency.QuadPart;
+
+    Menu::AddTab("Performance", PerformanceTab);
+    return true;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+namespace Profiler {
+
+struct Counter;
+
+// Checked once per instrumented call, so a disabled profiler costs a single
+// branch
+extern bool Enabled;
+
+// Registers a timed hook callback, attributed to the current owner
+Counter *Register(const char *hook);
+
+// Sets the addon that callbacks registered from now on are attributed to
+void SetOwner(const char *owner);
+
+long long Now();
+void Record(Counter *counter, long long start);
+
+// Calls a hook callback, timing it if the profiler is enabled
+template <typename Callback, typename... Args>
+inline auto Call(Counter *counter, Callback callback, Args &&...args) {
+    if (!Enabled) {
+        return callback(std::forward<Args>(args)...);
+    }
+
+    const auto start = Now();
+
+    if constexpr (std::is_void_v<decltype(callback(std::forward<Args>(args)...))>) {
+        callback(std::forward<Args>(args)...);
+        Record(counter, start);
+    } else {
+        const auto ret = callback(std::forward<Args>(args)...);
+        Record(counter, start);
+
+        return ret;
+    }
+}
+
+bool Initialize();
+
+} // namespace Profiler
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Bounded lock-free multi-producer single-consumer queue. Values live in
+// pre-sized cells and are filled and consumed in place, so pushing never
+// allocates. Any thread can push, only one thread may pop.
+template <typename T, size_t Capacity> class BoundedQueue {
+    static_assert(Capacity && !(Capacity & (Capacity - 1)),
+                  "Capacity must be a power of two");
+
+public:
+    BoundedQueue() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            cells[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue &) = delete;
+    BoundedQueue &operator=(const BoundedQueue &) = delete;
+
+    // Claims a cell and calls fill(T &) on it. Returns false if the queue is
+    // full
+    template <typename Fill> bool Push(Fill fill) {
+        auto position = head.load(std::memory_order_relaxed);
+
+        for (;;) {
+            auto &cell = cells[position & (Capacity - 1)];
+            const auto sequence = cell.Sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<intptr_t>(sequence) -
+                                    static_cast<intptr_t>(position);
+
+            if (difference == 0) {
+                if (head.compare_exchange_weak(position, position + 1,
+                                               std::memory_order_relaxed)) {
+
+                    fill(cell.Value);
+                    cell.Sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Calls consume(T &) on the oldest value. Returns false if the queue is
+    // empty. Consumer thread only
+    template <typename Consume> bool Pop(Consume consume) {
+        const auto position = tail.load(std::memory_order_relaxed);
+        auto &cell = cells[position & (Capacity - 1)];
+
+        if (cell.Sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+
+        consume(cell.Value);
+
+        cell.Sequence.store(position + Capacity, std::memory_order_release);
+        tail.store(position + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Consumer thread only
+    bool Empty() const {
+        const auto position = tail.load(std::memory_order_relaxed);
+        return cells[position & (Capacity - 1)].Sequence.load(
+                   std::memory_order_acquire) != position + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> Sequence;
+        T Value;
+    };
+
+    Cell cells[Capacity];
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+};
@@ -0,0 +1,236 @@
+#include <cstring>
+#include <vector>
+
+#include "scanner.h"
+
+// SSE2 is part of every x86 target the client and the tests build for, other
+// targets only get the scalar loop
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#define SCANNER_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Index of the lowest set bit, value must not be 0
+static int LowestBit(unsigned int value) {
+#ifdef _MSC_VER
+	unsigned long bit;
+	_BitScanForward(&bit, value);
+
+	return static_cast<int>(bit);
+#else
+	return __builtin_ctz(value);
+#endif
+}
+
+bool Pattern::CheckMask(void *base, const char *pattern, const char *mask) {
+	for (auto b = reinterpret_cast<char *>(base); *mask; ++b, ++pattern, ++mask) {
+		if ('x' == *mask && *b != *pattern) {
+			return false;
+		}
+	}
+
+	return base != nullptr;
+}
+
+// Rough frequency of bytes in x86 code, higher is more common. Anchoring the
+// scan on a rare byte keeps the number of candidates to verify low
+static int Commonness(unsigned char byte) {
+	switch (byte) {
+	case 0x00:
+	case 0xFF:
+	case 0xCC:
+		return 4;
+	case 0x8B:
+	case 0x89:
+	case 0x24:
+	case 0x44:
+	case 0x0F:
+	case 0x83:
+	case 0xE8:
+	case 0x8D:
+	case 0x04:
+	case 0x08:
+	case 0x01:
+		return 3;
+	case 0x85:
+	case 0x74:
+	case 0x75:
+	case 0x0C:
+	case 0x10:
+	case 0x14:
+	case 0x50:
+	case 0x51:
+	case 0x53:
+	case 0x55:
+	case 0x56:
+	case 0x57:
+	case 0x5E:
+	case 0x5F:
+	case 0x6A:
+	case 0xC3:
+	case 0xC4:
+	case 0xEC:
+		return 2;
+	default:
+		return 1;
+	}
+}
+
+// Picks the two rarest fixed bytes of the pattern. Returns false if every
+// byte is a wildcard
+static bool FindAnchors(const char *pattern, const char *mask, int length, int &first, int &second) {
+	first = second = -1;
+
+	for (int i = 0; i < length; ++i) {
+		if ('x' != mask[i]) {
+			continue;
+		}
+
+		const auto commonness = Commonness(static_cast<unsigned char>(pattern[i]));
+		if (first < 0 || commonness < Commonness(static_cast<unsigned char>(pattern[first]))) {
+			second = first;
+			first = i;
+		} else if (second < 0 || commonness < Commonness(static_cast<unsigned char>(pattern[second]))) {
+			second = i;
+		}
+	}
+
+	if (second < 0) {
+		second = first;
+	}
+
+	return first >= 0;
+}
+
+// A signature prepared for scanning
+struct Scanner {
+	const char *Bytes;
+	const char *Mask;
+	int Length;
+
+	// Offsets of the anchors, -1 if every byte is a wildcard
+	int First;
+	int Second;
+#ifdef SCANNER_SSE2
+	__m128i FirstVector;
+	__m128i SecondVector;
+#endif
+
+	Scanner(const char *pattern, const char *mask) : Bytes(pattern), Mask(mask) {
+		Length = static_cast<int>(strlen(mask));
+
+		FindAnchors(pattern, mask, Length, First, Second);
+
+#ifdef SCANNER_SSE2
+		if (First >= 0) {
+			FirstVector = _mm_set1_epi8(pattern[First]);
+			SecondVector = _mm_set1_epi8(pattern[Second]);
+		}
+#endif
+	}
+
+	// Returns the offset of the first match starting in [begin, end), or -1.
+	// Matches may extend past end, but not past size
+	int Scan(const unsigned char *bytes, int size, int begin, int end) const {
+		end = end < size - Length + 1 ? end : size - Length + 1;
+
+		if (First < 0) {
+			for (int i = begin; i < end; ++i) {
+				if (Pattern::CheckMask(const_cast<unsigned char *>(bytes) + i, Bytes, Mask)) {
+					return i;
+				}
+			}
+
+			return -1;
+		}
+
+		int i = begin;
+
+#ifdef SCANNER_SSE2
+		const auto reach = First > Second ? First : Second;
+
+		// Compares 16 candidate offsets at once against both anchors, only
+		// offsets matching both are verified against the full mask
+		for (; i < end && i + reach + 16 <= size; i += 16) {
+			const auto firstBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i + First));
+			const auto secondBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i + Second));
+
+			auto candidates = static_cast<unsigned int>(_mm_movemask_epi8(
+				_mm_and_si128(_mm_cmpeq_epi8(firstBlock, FirstVector), _mm_cmpeq_epi8(secondBlock, SecondVector))));
+
+			while (candidates) {
+				const auto offset = i + LowestBit(candidates);
+				candidates &= candidates - 1;
+
+				if (offset < end && Pattern::CheckMask(const_cast<unsigned char *>(bytes) + offset, Bytes, Mask)) {
+					return offset;
+				}
+			}
+		}
+#endif
+
+		for (; i < end; ++i) {
+			if (bytes[i + First] == static_cast<unsigned char>(Bytes[First]) &&
+				bytes[i + Second] == static_cast<unsigned char>(Bytes[Second]) &&
+				Pattern::CheckMask(const_cast<unsigned char *>(bytes) + i, Bytes, Mask)) {
+
+				return i;
+			}
+		}
+
+		return -1;
+	}
+};
+
+void *Pattern::FindPattern(void *base, int size, const char *pattern, const char *mask) {
+	if (!base) {
+		return nullptr;
+	}
+
+	const auto bytes = reinterpret_cast<unsigned char *>(base);
+	const auto offset = Scanner(pattern, mask).Scan(bytes, size, 0, size);
+
+	return offset < 0 ? nullptr : bytes + offset;
+}
+
+bool Pattern::FindPatterns(void *base, int size, Signature *signatures, size_t count) {
+	// Small enough to stay in L2 while every signature scans it
+	static const int BlockSize = 0x10000;
+
+	std::vector<Scanner> scanners;
+	scanners.reserve(count);
+
+	for (size_t i = 0; i < count; ++i) {
+		signatures[i].Result = nullptr;
+		scanners.emplace_back(signatures[i].Pattern, signatures[i].Mask);
+	}
+
+	if (!base) {
+		return false;
+	}
+
+	const auto bytes = reinterpret_cast<unsigned char *>(base);
+	auto remaining = count;
+
+	for (int block = 0; block < size && remaining; block += BlockSize) {
+		const auto end = block + BlockSize < size ? block + BlockSize : size;
+
+		for (size_t i = 0; i < count; ++i) {
+			if (signatures[i].Result) {
+				continue;
+			}
+
+			const auto offset = scanners[i].Scan(bytes, size, block, end);
+			if (offset >= 0) {
+				signatures[i].Result = bytes + offset;
+				--remaining;
+			}
+		}
+	}
+
+	return remaining == 0;
+}
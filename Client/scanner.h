@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+
+// The platform free half of Pattern: matching signatures against a block of
+// memory. pattern.h adds the lookups by module and the offset cache on top.
+namespace Pattern {
+
+bool CheckMask(void *base, const char *pattern, const char *mask);
+void *FindPattern(void *base, int size, const char *pattern, const char *mask);
+
+struct Signature {
+	const char *Pattern;
+	const char *Mask;
+	void *Result;
+};
+
+// Finds several signatures in one pass over the image. Every result is set to
+// its first match or nullptr. Returns false if any signature wasn't found
+bool FindPatterns(void *base, int size, Signature *signatures, size_t count);
+
+}; // namespace Pattern
@@ -3,8 +3,11 @@
 // Mirror's Edge (1.0) SDK
 
 #include <set>
+#include <atomic>
 #include <string>
 #include <locale>
+#include <mutex>
+#include <unordered_map>
 
 #include "sdk/ME_Basic.hpp"
 
@@ -10,6 +10,272 @@ namespace Classes
 {
 TArray<FNameEntry*>* FName::GNames = nullptr;
 TArray<UObject*>* UObject::GObjects = nullptr;
+
+static const uint64_t FNVOffset = 14695981039346656037ull;
+static const uint64_t FNVPrime = 1099511628211ull;
+
+static inline uint64_t HashChar(uint64_t hash, char c)
+{
+	return (hash ^ static_cast<unsigned char>(c)) * FNVPrime;
+}
+
+static inline char NarrowChar(wchar_t c)
+{
+	// Same narrowing as FNameEntry::GetName for ASCII names
+	return c < 0x80 ? static_cast<char>(c) : '?';
+}
+
+// Name hash -> GNames index. Names are only ever appended, so the table is
+// extended with the new entries whenever a lookup misses
+static struct
+{
+	std::unordered_multimap<uint64_t, int32_t> Indices;
+	uint32_t Indexed = 0;
+	std::mutex Mutex;
+} nameIndex;
+
+static bool ProbeNameIndex(const char* name, size_t length, uint64_t hash, int32_t& index)
+{
+	const auto& names = FName::GetGlobalNames();
+	const auto range = nameIndex.Indices.equal_range(hash);
+
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		const auto entry = names.GetByIndex(it->second);
+
+		auto i = 0u;
+		while (i < length && entry->WideName[i] == static_cast<wchar_t>(static_cast<unsigned char>(name[i])))
+		{
+			++i;
+		}
+
+		if (i == length && entry->WideName[length] == L'\0')
+		{
+			index = it->second;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Adds the names after the ones indexed so far up to last, returns false if
+// there were none
+static bool IndexNames(uint32_t last)
+{
+	const auto& names = FName::GetGlobalNames();
+	if (nameIndex.Indexed >= last)
+	{
+		return false;
+	}
+
+	for (auto i = nameIndex.Indexed; i < last; ++i)
+	{
+		const auto entry = names.GetByIndex(i);
+		if (entry == nullptr)
+		{
+			continue;
+		}
+
+		auto entryHash = FNVOffset;
+		for (auto c = entry->WideName; *c; ++c)
+		{
+			entryHash = HashChar(entryHash, NarrowChar(*c));
+		}
+
+		nameIndex.Indices.emplace(entryHash, static_cast<int32_t>(i));
+	}
+
+	nameIndex.Indexed = last;
+
+	return true;
+}
+
+bool FName::FindIndex(const char* name, size_t length, int32_t& index)
+{
+	auto hash = FNVOffset;
+	for (auto i = 0u; i < length; ++i)
+	{
+		hash = HashChar(hash, name[i]);
+	}
+
+	std::lock_guard<std::mutex> lock(nameIndex.Mutex);
+
+	if (ProbeNameIndex(name, length, hash, index))
+	{
+		return true;
+	}
+
+	return IndexNames(static_cast<uint32_t>(GetGlobalNames().Num())) && ProbeNameIndex(name, length, hash, index);
+}
+
+bool FName::PrepareIndex(uint32_t budget)
+{
+	std::lock_guard<std::mutex> lock(nameIndex.Mutex);
+
+	const auto count = static_cast<uint32_t>(GetGlobalNames().Num());
+	const auto last = count > nameIndex.Indexed + budget ? nameIndex.Indexed + budget : count;
+	IndexNames(last);
+
+	return last == count;
+}
+
+static uint64_t HashName(uint64_t hash, const FName& name)
+{
+	const auto entry = FName::GetGlobalNames()[name.Index];
+
+	for (auto c = entry->WideName; *c; ++c)
+	{
+		hash = HashChar(hash, NarrowChar(*c));
+	}
+
+	if (name.Number > 0)
+	{
+		char digits[16];
+		auto count = 0;
+
+		for (auto number = static_cast<uint32_t>(name.Number - 1); count == 0 || number; number /= 10)
+		{
+			digits[count++] = '0' + number % 10;
+		}
+
+		hash = HashChar(hash, '_');
+		while (count)
+		{
+			hash = HashChar(hash, digits[--count]);
+		}
+	}
+
+	return hash;
+}
+
+static bool ParsePart(const char* text, size_t length, FObjectPath::FPart& part)
+{
+	part.Index = part.BaseIndex = -1;
+	part.BaseNumber = 0;
+
+	FName::FindIndex(text, length, part.Index);
+
+	// A trailing "_N" without leading zeros may be the instance number
+	auto digits = length;
+	while (digits > 0 && text[digits - 1] >= '0' && text[digits - 1] <= '9')
+	{
+		--digits;
+	}
+
+	if (digits > 1 && digits < length && text[digits - 1] == '_' && (text[digits] != '0' || digits + 1 == length) && length - digits < 10)
+	{
+		int32_t number = 0;
+		for (auto i = digits; i < length; ++i)
+		{
+			number = number * 10 + (text[i] - '0');
+		}
+
+		if (FName::FindIndex(text, digits - 1, part.BaseIndex))
+		{
+			part.BaseNumber = number + 1;
+		}
+	}
+
+	return part.Index != -1 || part.BaseIndex != -1;
+}
+
+FObjectPath::FObjectPath(const std::string& fullName)
+	: Depth(0),
+	  Hash(FNVOffset),
+	  IsValid(false)
+{
+	for (auto c : fullName)
+	{
+		Hash = HashChar(Hash, c);
+	}
+
+	const auto space = fullName.find(' ');
+	if (space == std::string::npos || !ParsePart(fullName.c_str(), space, Class))
+	{
+		return;
+	}
+
+	for (auto begin = space + 1; ; )
+	{
+		auto end = fullName.find('.', begin);
+		if (end == std::string::npos)
+		{
+			end = fullName.size();
+		}
+
+		if (Depth == MaxDepth || !ParsePart(fullName.c_str() + begin, end - begin, Parts[Depth]))
+		{
+			return;
+		}
+
+		++Depth;
+
+		if (end == fullName.size())
+		{
+			break;
+		}
+
+		begin = end + 1;
+	}
+
+	IsValid = true;
+}
+
+bool FObjectPath::Matches(const UObject* object) const
+{
+	if (!IsValid || object->Class == nullptr || !Class.Matches(object->Class->Name))
+	{
+		return false;
+	}
+
+	auto p = object;
+	for (auto i = Depth - 1; i >= 0; --i, p = p->Outer)
+	{
+		if (p == nullptr || !Parts[i].Matches(p->Name))
+		{
+			return false;
+		}
+	}
+
+	return p == nullptr;
+}
+
+uint64_t FObjectPath::HashOf(const UObject* object)
+{
+	if (object->Class == nullptr)
+	{
+		return 0;
+	}
+
+	const UObject* chain[MaxDepth];
+	auto depth = 0;
+
+	for (auto p = object; p; p = p->Outer)
+	{
+		if (depth == MaxDepth)
+		{
+			// Deeper than any path that can be looked up
+			return 0;
+		}
+
+		chain[depth++] = p;
+	}
+
+	auto hash = HashChar(HashName(FNVOffset, object->Class->Name), ' ');
+
+	while (depth > 0)
+	{
+		hash = HashName(hash, chain[--depth]->Name);
+
+		if (depth > 0)
+		{
+			hash = HashChar(hash, '.');
+		}
+	}
+
+	return hash;
+}
 }
 
 #ifdef _MSC_VER
@@ -208,32 +208,7 @@ struct FName
 		: Index(0),
 		  Number(0)
 	{
-		static std::set<size_t> cache;
-
-		for (auto i : cache)
-		{
-			if (GetGlobalNames()[i]->GetName() == nameToFind)
-			{
-				Index = i;
-				
-				return;
-			}
-		}
-
-		for (auto i = 0u; i < GetGlobalNames().Num(); ++i)
-		{
-			if (GetGlobalNames()[i] != nullptr)
-			{
-				if (GetGlobalNames()[i]->GetName() == nameToFind)
-				{
-					cache.insert(i);
-
-					Index = i;
-
-					return;
-				}
-			}
-		}
+		FindIndex(nameToFind, std::strlen(nameToFind), Index);
 	};
 
 	static TArray<FNameEntry*>* GNames;
@@ -242,6 +217,14 @@ struct FName
 		return *GNames;
 	};
 
+	// Finds the GNames index of an exact name through a hash table built lazily
+	// from GNames, without building temporary strings
+	static bool FindIndex(const char* name, size_t length, int32_t& index);
+
+	// Adds up to budget names to the table, so it can be built up front a slice
+	// at a time instead of by the first lookups. Returns true once it's complete
+	static bool PrepareIndex(uint32_t budget);
+
 	inline std::string GetName() const
 	{
 		auto name = GetGlobalNames()[Index]->GetName();
@@ -260,6 +243,39 @@ struct FName
 	};
 };
 
+// A full object name ("Class Outer.Outer.Name") split once into name indices, so
+// objects can be compared against it by walking their Outer chain without allocating
+struct FObjectPath
+{
+	static const int32_t MaxDepth = 16;
+
+	// "Foo_3" is either the name "Foo_3" or the name "Foo" with Number 4
+	struct FPart
+	{
+		int32_t Index;
+		int32_t BaseIndex;
+		int32_t BaseNumber;
+
+		bool Matches(const FName& name) const
+		{
+			return (name.Number == 0 && name.Index == Index) || (name.Index == BaseIndex && name.Number == BaseNumber);
+		}
+	};
+
+	FPart Class;
+	FPart Parts[MaxDepth];
+	int32_t Depth;
+	uint64_t Hash;
+	bool IsValid;
+
+	explicit FObjectPath(const std::string& fullName);
+
+	bool Matches(const UObject* object) const;
+
+	// Hash of the object's full name, equal to the hash of the FObjectPath built from it
+	static uint64_t HashOf(const UObject* object);
+};
+
 class FScriptInterface
 {
 private:
@@ -57,24 +57,24 @@ public:
 
 	std::string GetFullName() const;
 
+	// Looks up an object by its full name ("Class Outer.Name") through a hash index
+	// over GObjects instead of scanning the whole table
+	static UObject* FindObjectByFullName(const std::string& name);
+
+	// Indexes up to budget more GNames entries or GObjects slots, so the index
+	// can be built a slice per frame before SDK wrappers need it. Returns true
+	// once every name and object is indexed. Game thread only, it reads the
+	// engine's arrays
+	static bool PrepareObjectIndex(uint32_t budget);
+
+	// Tells the index that freed GObjects slots may have been reused, e.g.
+	// after a level load, so the next miss rebuilds it
+	static void InvalidateObjectIndex();
+
 	template<typename T>
 	static T* FindObject(const std::string& name)
 	{
-		for (auto i = 0u; i < GetGlobalObjects().Num(); ++i)
-		{
-			auto object = GetGlobalObjects().GetByIndex(i);
-	
-			if (object == nullptr)
-			{
-				continue;
-			}
-	
-			if (object->GetFullName() == name)
-			{
-				return static_cast<T*>(object);
-			}
-		}
-		return nullptr;
+		return static_cast<T*>(FindObjectByFullName(name));
 	}
 
 	static UClass* FindClass(const std::string& name)
@@ -96,6 +96,12 @@ public:
 		return ptr;
 	}
 
+	// Native functions already carry FUNC_Native (0x400) and are dispatched
+	// straight to their thunk, so wrappers leave the shared FunctionFlags alone.
+	// Calling UFunction::Func directly would skip this dispatch, but the thunk
+	// reads its parameters through an FFrame (Code, Locals and the OutParms
+	// chain for out parameters) that this SDK doesn't describe. A wrong guess
+	// at that layout breaks every native call, so they go through here
 	inline void ProcessEvent(class UFunction* function, void* parms)
 	{
 		void *ret = nullptr;
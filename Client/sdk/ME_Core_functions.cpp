@@ -34,9 +34,273 @@ std::string UObject::GetFullName() const
 	return name;
 }
 
-bool UObject::IsA(UClass *cmp) const {
+// Full name hash -> GObjects slots. Built in a single pass over GObjects and
+// extended with the objects appended since the last lookup. Hashes are computed
+// from the name indices directly, so neither indexing nor probing allocates
+static struct
+{
+	std::unordered_multimap<uint64_t, uint32_t> Slots;
+	uint32_t Indexed = 0;
+	std::mutex Mutex;
+
+	// Bumped whenever the engine may have reused freed slots. A miss only
+	// rebuilds the index once per generation and GObjects size
+	uint32_t Generation = 0;
+	uint32_t RebuiltGeneration = UINT32_MAX;
+	uint32_t RebuiltCount = 0;
+} objectIndex;
+
+// Indexes the slots from first up to last, which must follow the ones indexed so far
+static void IndexObjects(uint32_t first, uint32_t last)
+{
+	const auto& objects = UObject::GetGlobalObjects();
+
+	for (auto i = first; i < last; ++i)
+	{
+		const auto object = objects.GetByIndex(i);
+
+		if (object != nullptr)
+		{
+			objectIndex.Slots.emplace(FObjectPath::HashOf(object), i);
+		}
+	}
+
+	objectIndex.Indexed = last;
+}
+
+static UObject* ProbeObjectIndex(const FObjectPath& path)
+{
+	const auto& objects = UObject::GetGlobalObjects();
+	const auto range = objectIndex.Slots.equal_range(path.Hash);
+
+	UObject* found = nullptr;
+	auto foundSlot = UINT32_MAX;
+
+	for (auto it = range.first; it != range.second; )
+	{
+		const auto slot = it->second;
+		const auto object = slot < objects.Num() ? objects.GetByIndex(slot) : nullptr;
+
+		// The object was destroyed or its slot was reused
+		if (object == nullptr || FObjectPath::HashOf(object) != path.Hash)
+		{
+			it = objectIndex.Slots.erase(it);
+			continue;
+		}
+
+		// Keeps the lowest slot for duplicate names, same as the old linear scan
+		if (slot < foundSlot && path.Matches(object))
+		{
+			found = object;
+			foundSlot = slot;
+		}
+
+		++it;
+	}
+
+	return found;
+}
+
+UObject* UObject::FindObjectByFullName(const std::string& name)
+{
+	const FObjectPath path(name);
+	if (!path.IsValid)
+	{
+		// One of the names was never registered, so no such object exists
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(objectIndex.Mutex);
+
+	auto object = ProbeObjectIndex(path);
+	if (object != nullptr)
+	{
+		return object;
+	}
+
+	if (objectIndex.Indexed < GetGlobalObjects().Num())
+	{
+		IndexObjects(objectIndex.Indexed, static_cast<uint32_t>(GetGlobalObjects().Num()));
+
+		if ((object = ProbeObjectIndex(path)) != nullptr)
+		{
+			return object;
+		}
+	}
+
+	// Freed slots are handed out to new objects, so those are only picked up
+	// by a full rebuild. Nothing can have been reused since the last one if
+	// neither the generation nor GObjects changed
+	const auto count = static_cast<uint32_t>(GetGlobalObjects().Num());
+	if (objectIndex.RebuiltGeneration == objectIndex.Generation && objectIndex.RebuiltCount == count)
+	{
+		return nullptr;
+	}
+
+	objectIndex.RebuiltGeneration = objectIndex.Generation;
+	objectIndex.RebuiltCount = count;
+	objectIndex.Slots.clear();
+	IndexObjects(0, count);
+
+	return ProbeObjectIndex(path);
+}
+
+void UObject::InvalidateObjectIndex()
+{
+	std::lock_guard<std::mutex> lock(objectIndex.Mutex);
+
+	++objectIndex.Generation;
+}
+
+bool UObject::PrepareObjectIndex(uint32_t budget)
+{
+	// Names first, then objects, each in slices of up to budget
+	if (!FName::PrepareIndex(budget))
+	{
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(objectIndex.Mutex);
+
+	const auto count = static_cast<uint32_t>(GetGlobalObjects().Num());
+	if (objectIndex.Indexed >= count)
+	{
+		return true;
+	}
+
+	if (objectIndex.Indexed == 0)
+	{
+		objectIndex.Slots.reserve(count);
+	}
+
+	// Picks up where the last slice or lookup stopped
+	const auto last = count - objectIndex.Indexed > budget ? objectIndex.Indexed + budget : count;
+	IndexObjects(objectIndex.Indexed, last);
+
+	return last == count;
+}
+
+// Class ancestry, indexed by the class's GObjects slot. Ancestors holds the chain
+// from the root class down to the class itself, so IsA only has to compare the
+// ancestor at the other class's depth. Entries are filled in lazily the first
+// time a class is seen and are read without taking the lock
+struct FClassAncestry
+{
+	std::atomic<UClass*> Class;
+	int32_t Depth;
+	UClass** Ancestors;
+};
+
+static const uint32_t AncestryChunkSize = 1024;
+static const uint32_t AncestryChunkCount = 1024;
+static const int32_t AncestryMaxDepth = 64;
+
+static struct
+{
+	std::atomic<FClassAncestry*> Chunks[AncestryChunkCount];
+	std::mutex Mutex;
+} classAncestry;
+
+static const FClassAncestry* FindAncestry(const UClass* cls)
+{
+	__try {
+		const auto slot = static_cast<uint32_t>(cls->ObjectInternalInteger);
+		if (slot >= AncestryChunkSize * AncestryChunkCount) {
+			return nullptr;
+		}
+
+		const auto chunk = classAncestry.Chunks[slot / AncestryChunkSize].load(std::memory_order_acquire);
+		if (chunk == nullptr) {
+			return nullptr;
+		}
+
+		const auto entry = &chunk[slot % AncestryChunkSize];
+		if (entry->Class.load(std::memory_order_acquire) == cls) {
+			return entry;
+		}
+	} __except (EXCEPTION_EXECUTE_HANDLER) {
+		// NOTHING
+	}
+
+	return nullptr;
+}
+
+// Collects the SuperField chain leaf first, returns its length or 0 if it is unreadable
+static int32_t WalkAncestry(UClass* cls, UClass** chain)
+{
+	auto depth = 0;
+
+	__try {
+		for (auto super = cls; super; super = static_cast<UClass *>(super->SuperField)) {
+			if (depth == AncestryMaxDepth) {
+				return 0;
+			}
+
+			chain[depth++] = super;
+		}
+	} __except (EXCEPTION_EXECUTE_HANDLER) {
+		return 0;
+	}
+
+	return depth;
+}
+
+static const FClassAncestry* CacheAncestry(UClass* cls)
+{
+	UClass* chain[AncestryMaxDepth];
+
+	const auto length = WalkAncestry(cls, chain);
+	if (length == 0) {
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(classAncestry.Mutex);
+
+	// Shared by every class in the chain and never freed, since readers don't lock.
+	// Only allocated once an entry is stored, so fully cached chains cost nothing
+	UClass** ancestors = nullptr;
+
+	for (auto depth = 0; depth < length; ++depth) {
+		const auto ancestor = chain[length - 1 - depth];
+		const auto slot = static_cast<uint32_t>(ancestor->ObjectInternalInteger);
+		if (slot >= AncestryChunkSize * AncestryChunkCount) {
+			continue;
+		}
+
+		auto chunk = classAncestry.Chunks[slot / AncestryChunkSize].load(std::memory_order_relaxed);
+		if (chunk == nullptr) {
+			chunk = new FClassAncestry[AncestryChunkSize]();
+			classAncestry.Chunks[slot / AncestryChunkSize].store(chunk, std::memory_order_release);
+		}
+
+		auto& entry = chunk[slot % AncestryChunkSize];
+		if (entry.Class.load(std::memory_order_relaxed) == ancestor) {
+			continue;
+		}
+
+		if (ancestors == nullptr) {
+			ancestors = new UClass*[length];
+			for (auto i = 0; i < length; ++i) {
+				ancestors[i] = chain[length - 1 - i];
+			}
+		}
+
+		// The slot belonged to a class that has since been freed
+		entry.Class.store(nullptr, std::memory_order_relaxed);
+		entry.Depth = depth;
+		entry.Ancestors = ancestors;
+		entry.Class.store(ancestor, std::memory_order_release);
+	}
+
+	return FindAncestry(cls);
+}
+
+// Used for classes the ancestry table can't hold, e.g. slots past its end or
+// chains deeper than AncestryMaxDepth
+static bool WalkIsA(UClass* cls, UClass* cmp)
+{
 	__try {
-		for (auto super = Class; super; super = static_cast<UClass *>(super->SuperField)) {
+		for (auto super = cls; super; super = static_cast<UClass *>(super->SuperField)) {
 			if (super == cmp) {
 				return true;
 			}
@@ -48,6 +312,24 @@ bool UObject::IsA(UClass *cmp) const {
 	return false;
 }
 
+bool UObject::IsA(UClass *cmp) const {
+	if (Class == nullptr || cmp == nullptr) {
+		return false;
+	}
+
+	auto ancestry = FindAncestry(Class);
+	if (ancestry == nullptr && (ancestry = CacheAncestry(Class)) == nullptr) {
+		return WalkIsA(Class, cmp);
+	}
+
+	auto target = FindAncestry(cmp);
+	if (target == nullptr && (target = CacheAncestry(cmp)) == nullptr) {
+		return WalkIsA(Class, cmp);
+	}
+
+	return ancestry->Depth >= target->Depth && ancestry->Ancestors[target->Depth] == cmp;
+}
+
 // Function Core.Object.TransformVectorByRotation
 // (Final, Native, Public)
 // Parameters:
@@ -65,13 +347,8 @@ struct FVector UObject::TransformVectorByRotation(const struct FRotator& SourceR
 	params.SourceVector = SourceVector;
 	params.bInverse = bInverse;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -87,12 +364,8 @@ struct FName UObject::GetPackageName()
 
 	UObject_GetPackageName_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -108,13 +381,8 @@ bool UObject::IsPendingKill()
 
 	UObject_IsPendingKill_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -134,12 +402,8 @@ float UObject::ByteToFloat(unsigned char inputByte, bool bSigned)
 	params.inputByte = inputByte;
 	params.bSigned = bSigned;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -159,12 +423,8 @@ unsigned char UObject::FloatToByte(float inputFloat, bool bSigned)
 	params.inputFloat = inputFloat;
 	params.bSigned = bSigned;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -182,12 +442,8 @@ float UObject::STATIC_UnwindHeading(float A)
 	UObject_UnwindHeading_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -207,12 +463,8 @@ float UObject::STATIC_FindDeltaAngle(float A1, float A2)
 	params.A1 = A1;
 	params.A2 = A2;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -230,12 +482,8 @@ float UObject::STATIC_GetHeadingAngle(const struct FVector& Dir)
 	UObject_GetHeadingAngle_Params params;
 	params.Dir = Dir;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -251,12 +499,8 @@ void UObject::STATIC_GetAngularDegreesFromRadians(struct FVector2D* OutFOV)
 
 	UObject_GetAngularDegreesFromRadians_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (OutFOV != nullptr)
 		*OutFOV = params.OutFOV;
 }
@@ -275,13 +519,8 @@ void UObject::STATIC_GetAngularFromDotDist(const struct FVector2D& DotDist, stru
 	UObject_GetAngularFromDotDist_Params params;
 	params.DotDist = DotDist;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (OutAngDist != nullptr)
 		*OutAngDist = params.OutAngDist;
 }
@@ -307,13 +546,8 @@ bool UObject::STATIC_GetAngularDistance(const struct FVector& Direction, const s
 	params.AxisY = AxisY;
 	params.AxisZ = AxisZ;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (OutAngularDist != nullptr)
 		*OutAngularDist = params.OutAngularDist;
 
@@ -341,13 +575,8 @@ bool UObject::STATIC_GetDotDistance(const struct FVector& Direction, const struc
 	params.AxisY = AxisY;
 	params.AxisZ = AxisZ;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (OutDotDist != nullptr)
 		*OutDotDist = params.OutDotDist;
 
@@ -372,12 +601,8 @@ bool UObject::STATIC_PointInBox(const struct FVector& Point, const struct FVecto
 	params.Location = Location;
 	params.Extent = Extent;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -400,12 +625,8 @@ float UObject::PointDistToPlane(const struct FVector& Point, const struct FRotat
 	params.Orientation = Orientation;
 	params.Origin = Origin;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (out_ClosestPoint != nullptr)
 		*out_ClosestPoint = params.out_ClosestPoint;
 
@@ -431,13 +652,8 @@ float UObject::PointDistToLine(const struct FVector& Point, const struct FVector
 	params.Line = Line;
 	params.Origin = Origin;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (OutClosestPoint != nullptr)
 		*OutClosestPoint = params.OutClosestPoint;
 
@@ -463,13 +679,8 @@ bool UObject::STATIC_GetPerObjectConfigSections(class UClass* SearchClass, class
 	params.ObjectOuter = ObjectOuter;
 	params.MaxResults = MaxResults;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (out_SectionNames != nullptr)
 		*out_SectionNames = params.out_SectionNames;
 
@@ -486,12 +697,7 @@ void UObject::STATIC_StaticSaveConfig()
 
 	UObject_StaticSaveConfig_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -504,12 +710,7 @@ void UObject::SaveConfig()
 
 	UObject_SaveConfig_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -528,13 +729,8 @@ class UObject* UObject::STATIC_FindObject(const struct FString& ObjectName, clas
 	params.ObjectName = ObjectName;
 	params.ObjectClass = ObjectClass;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -556,13 +752,8 @@ class UObject* UObject::STATIC_DynamicLoadObject(const struct FString& ObjectNam
 	params.ObjectClass = ObjectClass;
 	params.MayFail = MayFail;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -582,13 +773,8 @@ struct FName UObject::STATIC_GetEnum(class UObject* E, int I)
 	params.E = E;
 	params.I = I;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -605,12 +791,7 @@ void UObject::Disable(const struct FName& ProbeFunc)
 	UObject_Disable_Params params;
 	params.ProbeFunc = ProbeFunc;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -626,12 +807,7 @@ void UObject::Enable(const struct FName& ProbeFunc)
 	UObject_Enable_Params params;
 	params.ProbeFunc = ProbeFunc;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -644,11 +820,7 @@ void UObject::ContinuedState()
 
 	UObject_ContinuedState_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -661,11 +833,7 @@ void UObject::PausedState()
 
 	UObject_PausedState_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -678,11 +846,7 @@ void UObject::PoppedState()
 
 	UObject_PoppedState_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -695,11 +859,7 @@ void UObject::PushedState()
 
 	UObject_PushedState_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -715,11 +875,7 @@ void UObject::EndState(const struct FName& NextStateName)
 	UObject_EndState_Params params;
 	params.NextStateName = NextStateName;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -735,11 +891,7 @@ void UObject::BeginState(const struct FName& PreviousStateName)
 	UObject_BeginState_Params params;
 	params.PreviousStateName = PreviousStateName;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -752,12 +904,7 @@ void UObject::DumpStateStack()
 
 	UObject_DumpStateStack_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -773,12 +920,7 @@ void UObject::PopState(bool bPopAll)
 	UObject_PopState_Params params;
 	params.bPopAll = bPopAll;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -796,12 +938,7 @@ void UObject::PushState(const struct FName& NewState, const struct FName& NewLab
 	params.NewState = NewState;
 	params.NewLabel = NewLabel;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -816,13 +953,8 @@ struct FName UObject::GetStateName()
 
 	UObject_GetStateName_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -842,13 +974,8 @@ bool UObject::IsChildState(const struct FName& TestState, const struct FName& Te
 	params.TestState = TestState;
 	params.TestParentState = TestParentState;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -864,13 +991,8 @@ int UObject::GetStateStackSize()
 
 	UObject_GetStateStackSize_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -886,13 +1008,8 @@ struct FString UObject::GetStateStack()
 
 	UObject_GetStateStack_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -912,13 +1029,8 @@ bool UObject::IsInState(const struct FName& TestState, bool bTestStateStack)
 	params.TestState = TestState;
 	params.bTestStateStack = bTestStateStack;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -941,12 +1053,7 @@ void UObject::GotoState(const struct FName& NewState, const struct FName& Label,
 	params.bForceEvents = bForceEvents;
 	params.bKeepStack = bKeepStack;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -961,13 +1068,8 @@ bool UObject::STATIC_IsUTracing()
 
 	UObject_IsUTracing_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -984,12 +1086,7 @@ void UObject::STATIC_SetUTracing(bool bShouldUTrace)
 	UObject_SetUTracing_Params params;
 	params.bShouldUTrace = bShouldUTrace;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1004,13 +1101,8 @@ struct FName UObject::STATIC_GetFuncName()
 
 	UObject_GetFuncName_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1026,13 +1118,8 @@ struct FString UObject::STATIC_ScriptTraceString()
 
 	UObject_ScriptTraceString_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1046,12 +1133,7 @@ void UObject::STATIC_ScriptTrace()
 
 	UObject_ScriptTrace_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1072,13 +1154,8 @@ struct FString UObject::STATIC_Localize(const struct FString& SectionName, const
 	params.KeyName = KeyName;
 	params.PackageName = PackageName;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1095,12 +1172,7 @@ void UObject::STATIC_WarnInternal(const struct FString& S)
 	UObject_WarnInternal_Params params;
 	params.S = S;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1118,12 +1190,7 @@ void UObject::STATIC_LogInternal(const struct FString& S, const struct FName& Ta
 	params.S = S;
 	params.Tag = Tag;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1142,12 +1209,8 @@ struct FLinearColor UObject::STATIC_Subtract_LinearColorLinearColor(const struct
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1167,12 +1230,8 @@ struct FLinearColor UObject::STATIC_Multiply_LinearColorFloat(const struct FLine
 	params.LC = LC;
 	params.Mult = Mult;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1190,12 +1249,8 @@ struct FLinearColor UObject::STATIC_ColorToLinearColor(const struct FColor& OldC
 	UObject_ColorToLinearColor_Params params;
 	params.OldColor = OldColor;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1219,12 +1274,8 @@ struct FLinearColor UObject::STATIC_MakeLinearColor(float R, float G, float B, f
 	params.B = B;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1248,12 +1299,8 @@ struct FColor UObject::STATIC_MakeColor(unsigned char R, unsigned char G, unsign
 	params.B = B;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1273,12 +1320,8 @@ struct FColor UObject::STATIC_Add_ColorColor(const struct FColor& A, const struc
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1298,12 +1341,8 @@ struct FColor UObject::STATIC_Multiply_ColorFloat(const struct FColor& A, float
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1323,12 +1362,8 @@ struct FColor UObject::STATIC_Multiply_FloatColor(float A, const struct FColor&
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1348,12 +1383,8 @@ struct FColor UObject::STATIC_Subtract_ColorColor(const struct FColor& A, const
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1373,12 +1404,8 @@ struct FVector2D UObject::STATIC_vect2d(float InX, float InY)
 	params.InX = InX;
 	params.InY = InY;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1398,12 +1425,8 @@ float UObject::STATIC_GetRangePctByValue(const struct FVector2D& Range, float Va
 	params.Range = Range;
 	params.Value = Value;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1423,12 +1446,8 @@ float UObject::STATIC_GetRangeValueByPct(const struct FVector2D& Range, float Pc
 	params.Range = Range;
 	params.Pct = Pct;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1448,13 +1467,8 @@ struct FQuat UObject::STATIC_Subtract_QuatQuat(const struct FQuat& A, const stru
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1474,13 +1488,8 @@ struct FQuat UObject::STATIC_Add_QuatQuat(const struct FQuat& A, const struct FQ
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1504,13 +1513,8 @@ struct FQuat UObject::STATIC_QuatSlerp(const struct FQuat& A, const struct FQuat
 	params.Alpha = Alpha;
 	params.bShortestPath = bShortestPath;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1528,13 +1532,8 @@ struct FRotator UObject::STATIC_QuatToRotator(const struct FQuat& A)
 	UObject_QuatToRotator_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1552,13 +1551,8 @@ struct FQuat UObject::STATIC_QuatFromRotator(const struct FRotator& A)
 	UObject_QuatFromRotator_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1578,13 +1572,8 @@ struct FQuat UObject::STATIC_QuatFromAxisAndAngle(const struct FVector& Axis, fl
 	params.Axis = Axis;
 	params.Angle = Angle;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1604,13 +1593,8 @@ struct FQuat UObject::STATIC_QuatFindBetween(const struct FVector& A, const stru
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1630,13 +1614,8 @@ struct FVector UObject::STATIC_QuatRotateVector(const struct FQuat& A, const str
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1654,13 +1633,8 @@ struct FQuat UObject::STATIC_QuatInvert(const struct FQuat& A)
 	UObject_QuatInvert_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1680,13 +1654,8 @@ float UObject::STATIC_QuatDot(const struct FQuat& A, const struct FQuat& B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1706,13 +1675,8 @@ struct FQuat UObject::STATIC_QuatProduct(const struct FQuat& A, const struct FQu
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1730,13 +1694,8 @@ struct FVector UObject::STATIC_MatrixGetOrigin(const struct FMatrix& TM)
 	UObject_MatrixGetOrigin_Params params;
 	params.TM = TM;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1754,13 +1713,8 @@ struct FRotator UObject::STATIC_MatrixGetRotator(const struct FMatrix& TM)
 	UObject_MatrixGetRotator_Params params;
 	params.TM = TM;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1780,13 +1734,8 @@ struct FMatrix UObject::STATIC_MakeRotationTranslationMatrix(const struct FVecto
 	params.Translation = Translation;
 	params.Rotation = Rotation;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1806,13 +1755,8 @@ struct FVector UObject::STATIC_InverseTransformNormal(const struct FMatrix& TM,
 	params.TM = TM;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1832,13 +1776,8 @@ struct FVector UObject::STATIC_TransformNormal(const struct FMatrix& TM, const s
 	params.TM = TM;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1858,13 +1797,8 @@ struct FVector UObject::STATIC_InverseTransformVector(const struct FMatrix& TM,
 	params.TM = TM;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1884,13 +1818,8 @@ struct FVector UObject::STATIC_TransformVector(const struct FMatrix& TM, const s
 	params.TM = TM;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1910,13 +1839,8 @@ struct FMatrix UObject::STATIC_Multiply_MatrixMatrix(const struct FMatrix& A, co
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1936,13 +1860,8 @@ bool UObject::STATIC_NotEqual_NameName(const struct FName& A, const struct FName
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1962,13 +1881,8 @@ bool UObject::STATIC_EqualEqual_NameName(const struct FName& A, const struct FNa
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1986,13 +1900,8 @@ bool UObject::IsA(const struct FName& ClassName)
 	UObject_IsA_Params params;
 	params.ClassName = ClassName;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2012,13 +1921,8 @@ bool UObject::STATIC_ClassIsChildOf(class UClass* TestClass, class UClass* Paren
 	params.TestClass = TestClass;
 	params.ParentClass = ParentClass;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2038,13 +1942,8 @@ bool UObject::STATIC_NotEqual_InterfaceInterface(const TScriptInterface<class UI
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2064,13 +1963,8 @@ bool UObject::STATIC_EqualEqual_InterfaceInterface(const TScriptInterface<class
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2090,13 +1984,8 @@ bool UObject::STATIC_NotEqual_ObjectObject(class UObject* A, class UObject* B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2116,13 +2005,8 @@ bool UObject::STATIC_EqualEqual_ObjectObject(class UObject* A, class UObject* B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2140,13 +2024,8 @@ struct FString UObject::STATIC_PathName(class UObject* CheckObject)
 	UObject_PathName_Params params;
 	params.CheckObject = CheckObject;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2168,13 +2047,8 @@ void UObject::STATIC_ParseStringIntoArray(const struct FString& BaseString, cons
 	params.delim = delim;
 	params.bCullEmpty = bCullEmpty;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Pieces != nullptr)
 		*Pieces = params.Pieces;
 }
@@ -2197,12 +2071,8 @@ void UObject::STATIC_JoinArray(TArray<struct FString> StringArray, const struct
 	params.delim = delim;
 	params.bIgnoreBlanks = bIgnoreBlanks;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (out_Result != nullptr)
 		*out_Result = params.out_Result;
 }
@@ -2221,12 +2091,8 @@ struct FString UObject::STATIC_GetRightMost(const struct FString& Text)
 	UObject_GetRightMost_Params params;
 	params.Text = Text;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2248,12 +2114,8 @@ struct FString UObject::STATIC_Split(const struct FString& Text, const struct FS
 	params.SplitStr = SplitStr;
 	params.bOmitSplitStr = bOmitSplitStr;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2277,13 +2139,8 @@ struct FString UObject::STATIC_Repl(const struct FString& Src, const struct FStr
 	params.With = With;
 	params.bCaseSensitive = bCaseSensitive;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2301,13 +2158,8 @@ int UObject::STATIC_Asc(const struct FString& S)
 	UObject_Asc_Params params;
 	params.S = S;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2325,13 +2177,8 @@ struct FString UObject::STATIC_Chr(int I)
 	UObject_Chr_Params params;
 	params.I = I;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2349,13 +2196,8 @@ struct FString UObject::STATIC_Locs(const struct FString& S)
 	UObject_Locs_Params params;
 	params.S = S;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2373,13 +2215,8 @@ struct FString UObject::STATIC_Caps(const struct FString& S)
 	UObject_Caps_Params params;
 	params.S = S;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2399,13 +2236,8 @@ struct FString UObject::STATIC_Right(const struct FString& S, int I)
 	params.S = S;
 	params.I = I;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2425,13 +2257,8 @@ struct FString UObject::STATIC_Left(const struct FString& S, int I)
 	params.S = S;
 	params.I = I;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2453,13 +2280,8 @@ struct FString UObject::STATIC_Mid(const struct FString& S, int I, int J)
 	params.I = I;
 	params.J = J;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2481,13 +2303,8 @@ int UObject::STATIC_InStr(const struct FString& S, const struct FString& T, bool
 	params.T = T;
 	params.bSearchFromRight = bSearchFromRight;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2505,13 +2322,8 @@ int UObject::STATIC_Len(const struct FString& S)
 	UObject_Len_Params params;
 	params.S = S;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2530,13 +2342,8 @@ struct FString UObject::STATIC_SubtractEqual_StrStr(const struct FString& B, str
 	UObject_SubtractEqual_StrStr_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -2558,13 +2365,8 @@ struct FString UObject::STATIC_AtEqual_StrStr(const struct FString& B, struct FS
 	UObject_AtEqual_StrStr_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -2586,13 +2388,8 @@ struct FString UObject::STATIC_ConcatEqual_StrStr(const struct FString& B, struc
 	UObject_ConcatEqual_StrStr_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -2615,13 +2412,8 @@ bool UObject::STATIC_ComplementEqual_StrStr(const struct FString& A, const struc
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2641,13 +2433,8 @@ bool UObject::STATIC_NotEqual_StrStr(const struct FString& A, const struct FStri
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2667,13 +2454,8 @@ bool UObject::STATIC_EqualEqual_StrStr(const struct FString& A, const struct FSt
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2693,13 +2475,8 @@ bool UObject::STATIC_GreaterEqual_StrStr(const struct FString& A, const struct F
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2719,13 +2496,8 @@ bool UObject::STATIC_LessEqual_StrStr(const struct FString& A, const struct FStr
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2745,13 +2517,8 @@ bool UObject::STATIC_Greater_StrStr(const struct FString& A, const struct FStrin
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2771,13 +2538,8 @@ bool UObject::STATIC_Less_StrStr(const struct FString& A, const struct FString&
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2797,13 +2559,8 @@ struct FString UObject::STATIC_At_StrStr(const struct FString& A, const struct F
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2823,13 +2580,8 @@ struct FString UObject::STATIC_Concat_StrStr(const struct FString& A, const stru
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2856,12 +2608,8 @@ bool UObject::STATIC_SClampRotAxis(float DeltaTime, int ViewAxis, int MaxLimit,
 	params.MinLimit = MinLimit;
 	params.InterpolationSpeed = InterpolationSpeed;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (out_DeltaViewAxis != nullptr)
 		*out_DeltaViewAxis = params.out_DeltaViewAxis;
 
@@ -2886,12 +2634,8 @@ int UObject::STATIC_ClampRotAxisFromRange(int Current, int Min, int Max)
 	params.Min = Min;
 	params.Max = Max;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2913,12 +2657,8 @@ int UObject::STATIC_ClampRotAxisFromBase(int Current, int Center, int MaxDelta)
 	params.Center = Center;
 	params.MaxDelta = MaxDelta;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2940,12 +2680,8 @@ void UObject::STATIC_ClampRotAxis(int ViewAxis, int MaxLimit, int MinLimit, int*
 	params.MaxLimit = MaxLimit;
 	params.MinLimit = MinLimit;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (out_DeltaViewAxis != nullptr)
 		*out_DeltaViewAxis = params.out_DeltaViewAxis;
 }
@@ -2964,12 +2700,8 @@ float UObject::STATIC_RSize(const struct FRotator& R)
 	UObject_RSize_Params params;
 	params.R = R;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2989,13 +2721,8 @@ float UObject::STATIC_RDiff(const struct FRotator& A, const struct FRotator& B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3013,13 +2740,8 @@ int UObject::STATIC_NormalizeRotAxis(int Angle)
 	UObject_NormalizeRotAxis_Params params;
 	params.Angle = Angle;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3043,13 +2765,8 @@ struct FRotator UObject::STATIC_RInterpTo(const struct FRotator& Current, const
 	params.DeltaTime = DeltaTime;
 	params.InterpSpeed = InterpSpeed;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3073,13 +2790,8 @@ struct FRotator UObject::STATIC_RSmerp(const struct FRotator& A, const struct FR
 	params.Alpha = Alpha;
 	params.bShortestPath = bShortestPath;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3103,13 +2815,8 @@ struct FRotator UObject::STATIC_RLerp(const struct FRotator& A, const struct FRo
 	params.Alpha = Alpha;
 	params.bShortestPath = bShortestPath;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3127,13 +2834,8 @@ struct FRotator UObject::STATIC_Normalize(const struct FRotator& Rot)
 	UObject_Normalize_Params params;
 	params.Rot = Rot;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3155,13 +2857,8 @@ struct FRotator UObject::STATIC_OrthoRotation(const struct FVector& X, const str
 	params.Y = Y;
 	params.Z = Z;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3179,13 +2876,8 @@ struct FRotator UObject::STATIC_RotRand(bool bRoll)
 	UObject_RotRand_Params params;
 	params.bRoll = bRoll;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3205,13 +2897,8 @@ void UObject::STATIC_GetUnAxes(const struct FRotator& A, struct FVector* X, stru
 	UObject_GetUnAxes_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (X != nullptr)
 		*X = params.X;
 	if (Y != nullptr)
@@ -3236,13 +2923,8 @@ void UObject::STATIC_GetAxes(const struct FRotator& A, struct FVector* X, struct
 	UObject_GetAxes_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (X != nullptr)
 		*X = params.X;
 	if (Y != nullptr)
@@ -3267,13 +2949,8 @@ bool UObject::STATIC_ClockwiseFrom_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3292,13 +2969,8 @@ struct FRotator UObject::STATIC_SubtractEqual_RotatorRotator(const struct FRotat
 	UObject_SubtractEqual_RotatorRotator_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -3320,13 +2992,8 @@ struct FRotator UObject::STATIC_AddEqual_RotatorRotator(const struct FRotator& B
 	UObject_AddEqual_RotatorRotator_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -3349,13 +3016,8 @@ struct FRotator UObject::STATIC_Subtract_RotatorRotator(const struct FRotator& A
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3375,13 +3037,8 @@ struct FRotator UObject::STATIC_Add_RotatorRotator(const struct FRotator& A, con
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3400,13 +3057,8 @@ struct FRotator UObject::STATIC_DivideEqual_RotatorFloat(float B, struct FRotato
 	UObject_DivideEqual_RotatorFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -3428,13 +3080,8 @@ struct FRotator UObject::STATIC_MultiplyEqual_RotatorFloat(float B, struct FRota
 	UObject_MultiplyEqual_RotatorFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -3457,13 +3104,8 @@ struct FRotator UObject::STATIC_Divide_RotatorFloat(const struct FRotator& A, fl
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3483,13 +3125,8 @@ struct FRotator UObject::STATIC_Multiply_FloatRotator(float A, const struct FRot
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3509,13 +3146,8 @@ struct FRotator UObject::STATIC_Multiply_RotatorFloat(const struct FRotator& A,
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3535,13 +3167,8 @@ bool UObject::STATIC_NotEqual_RotatorRotator(const struct FRotator& A, const str
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3561,13 +3188,8 @@ bool UObject::STATIC_EqualEqual_RotatorRotator(const struct FRotator& A, const s
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3587,13 +3209,8 @@ struct FVector UObject::STATIC_ClampLength(const struct FVector& V, float MaxLen
 	params.V = V;
 	params.MaxLength = MaxLength;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3617,13 +3234,8 @@ struct FVector UObject::STATIC_VInterpTo(const struct FVector& Current, const st
 	params.DeltaTime = DeltaTime;
 	params.InterpSpeed = InterpSpeed;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3641,13 +3253,8 @@ bool UObject::STATIC_IsZero(const struct FVector& A)
 	UObject_IsZero_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3667,13 +3274,8 @@ struct FVector UObject::STATIC_ProjectOnTo(const struct FVector& X, const struct
 	params.X = X;
 	params.Y = Y;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3693,13 +3295,8 @@ struct FVector UObject::STATIC_MirrorVectorByNormal(const struct FVector& InVect
 	params.InVect = InVect;
 	params.InNormal = InNormal;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3715,13 +3312,8 @@ struct FVector UObject::STATIC_VRand()
 
 	UObject_VRand_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3743,13 +3335,8 @@ struct FVector UObject::STATIC_VSmerp(const struct FVector& A, const struct FVec
 	params.B = B;
 	params.Alpha = Alpha;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3771,13 +3358,8 @@ struct FVector UObject::STATIC_VLerp(const struct FVector& A, const struct FVect
 	params.B = B;
 	params.Alpha = Alpha;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3795,13 +3377,8 @@ struct FVector UObject::STATIC_Normal(const struct FVector& A)
 	UObject_Normal_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3819,13 +3396,8 @@ float UObject::STATIC_VSizeSq2D(const struct FVector& A)
 	UObject_VSizeSq2D_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3843,13 +3415,8 @@ float UObject::STATIC_VSizeSq(const struct FVector& A)
 	UObject_VSizeSq_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3867,13 +3434,8 @@ float UObject::STATIC_VSize2D(const struct FVector& A)
 	UObject_VSize2D_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3891,13 +3453,8 @@ float UObject::STATIC_VSize(const struct FVector& A)
 	UObject_VSize_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3916,13 +3473,8 @@ struct FVector UObject::STATIC_SubtractEqual_VectorVector(const struct FVector&
 	UObject_SubtractEqual_VectorVector_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -3944,13 +3496,8 @@ struct FVector UObject::STATIC_AddEqual_VectorVector(const struct FVector& B, st
 	UObject_AddEqual_VectorVector_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -3972,13 +3519,8 @@ struct FVector UObject::STATIC_DivideEqual_VectorFloat(float B, struct FVector*
 	UObject_DivideEqual_VectorFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -4000,13 +3542,8 @@ struct FVector UObject::STATIC_MultiplyEqual_VectorVector(const struct FVector&
 	UObject_MultiplyEqual_VectorVector_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -4028,13 +3565,8 @@ struct FVector UObject::STATIC_MultiplyEqual_VectorFloat(float B, struct FVector
 	UObject_MultiplyEqual_VectorFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -4057,13 +3589,8 @@ struct FVector UObject::STATIC_Cross_VectorVector(const struct FVector& A, const
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4083,13 +3610,8 @@ float UObject::STATIC_Dot_VectorVector(const struct FVector& A, const struct FVe
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4109,13 +3631,8 @@ bool UObject::STATIC_NotEqual_VectorVector(const struct FVector& A, const struct
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4135,13 +3652,8 @@ bool UObject::STATIC_EqualEqual_VectorVector(const struct FVector& A, const stru
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4161,13 +3673,8 @@ struct FVector UObject::STATIC_GreaterGreater_VectorRotator(const struct FVector
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4187,13 +3694,8 @@ struct FVector UObject::STATIC_LessLess_VectorRotator(const struct FVector& A, c
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4213,13 +3715,8 @@ struct FVector UObject::STATIC_Subtract_VectorVector(const struct FVector& A, co
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4239,13 +3736,8 @@ struct FVector UObject::STATIC_Add_VectorVector(const struct FVector& A, const s
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4265,13 +3757,8 @@ struct FVector UObject::STATIC_Divide_VectorFloat(const struct FVector& A, float
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4291,13 +3778,8 @@ struct FVector UObject::STATIC_Multiply_VectorVector(const struct FVector& A, co
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4317,13 +3799,8 @@ struct FVector UObject::STATIC_Multiply_FloatVector(float A, const struct FVecto
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4343,13 +3820,8 @@ struct FVector UObject::STATIC_Multiply_VectorFloat(const struct FVector& A, flo
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4367,13 +3839,8 @@ struct FVector UObject::STATIC_Subtract_PreVector(const struct FVector& A)
 	UObject_Subtract_PreVector_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4397,13 +3864,8 @@ float UObject::STATIC_FInterpTo(float Current, float Target, float DeltaTime, fl
 	params.DeltaTime = DeltaTime;
 	params.InterpSpeed = InterpSpeed;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4425,12 +3887,8 @@ float UObject::STATIC_FPctByRange(float Value, float InMin, float InMax)
 	params.InMin = InMin;
 	params.InMax = InMax;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4450,12 +3908,8 @@ float UObject::STATIC_RandRange(float InMin, float InMax)
 	params.InMin = InMin;
 	params.InMax = InMax;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4479,13 +3933,8 @@ float UObject::STATIC_FInterpEaseInOut(float A, float B, float Alpha, float Exp)
 	params.Alpha = Alpha;
 	params.Exp = Exp;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4509,12 +3958,8 @@ float UObject::STATIC_FInterpEaseOut(float A, float B, float Alpha, float Exp)
 	params.Alpha = Alpha;
 	params.Exp = Exp;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4538,12 +3983,8 @@ float UObject::STATIC_FInterpEaseIn(float A, float B, float Alpha, float Exp)
 	params.Alpha = Alpha;
 	params.Exp = Exp;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4569,13 +4010,8 @@ float UObject::STATIC_FCubicInterp(float P0, float T0, float P1, float T1, float
 	params.T1 = T1;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4593,13 +4029,8 @@ int UObject::STATIC_Round(float A)
 	UObject_Round_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4621,13 +4052,8 @@ float UObject::STATIC_Lerp(float A, float B, float Alpha)
 	params.B = B;
 	params.Alpha = Alpha;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4649,13 +4075,8 @@ float UObject::STATIC_FClamp(float V, float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4675,13 +4096,8 @@ float UObject::STATIC_FMax(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4701,13 +4117,8 @@ float UObject::STATIC_FMin(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4723,13 +4134,8 @@ float UObject::STATIC_FRand()
 
 	UObject_FRand_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4747,13 +4153,8 @@ float UObject::STATIC_Square(float A)
 	UObject_Square_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4771,13 +4172,8 @@ float UObject::STATIC_Sqrt(float A)
 	UObject_Sqrt_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4795,13 +4191,8 @@ float UObject::STATIC_Loge(float A)
 	UObject_Loge_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4819,13 +4210,8 @@ float UObject::STATIC_Exp(float A)
 	UObject_Exp_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4845,13 +4231,8 @@ float UObject::STATIC_Atan(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4869,13 +4250,8 @@ float UObject::STATIC_Tan(float A)
 	UObject_Tan_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4893,13 +4269,8 @@ float UObject::STATIC_Acos(float A)
 	UObject_Acos_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4917,13 +4288,8 @@ float UObject::STATIC_Cos(float A)
 	UObject_Cos_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4941,13 +4307,8 @@ float UObject::STATIC_Asin(float A)
 	UObject_Asin_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4965,13 +4326,8 @@ float UObject::STATIC_Sin(float A)
 	UObject_Sin_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4989,13 +4345,8 @@ float UObject::STATIC_Abs(float A)
 	UObject_Abs_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5015,12 +4366,8 @@ int UObject::STATIC_Percent_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5039,13 +4386,8 @@ float UObject::STATIC_SubtractEqual_FloatFloat(float B, float* A)
 	UObject_SubtractEqual_FloatFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5067,13 +4409,8 @@ float UObject::STATIC_AddEqual_FloatFloat(float B, float* A)
 	UObject_AddEqual_FloatFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5095,13 +4432,8 @@ float UObject::STATIC_DivideEqual_FloatFloat(float B, float* A)
 	UObject_DivideEqual_FloatFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5123,13 +4455,8 @@ float UObject::STATIC_MultiplyEqual_FloatFloat(float B, float* A)
 	UObject_MultiplyEqual_FloatFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5152,13 +4479,8 @@ bool UObject::STATIC_NotEqual_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5178,13 +4500,8 @@ bool UObject::STATIC_ComplementEqual_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5204,13 +4521,8 @@ bool UObject::STATIC_EqualEqual_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5230,13 +4542,8 @@ bool UObject::STATIC_GreaterEqual_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5256,13 +4563,8 @@ bool UObject::STATIC_LessEqual_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5282,13 +4584,8 @@ bool UObject::STATIC_Greater_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5308,13 +4605,8 @@ bool UObject::STATIC_Less_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5334,13 +4626,8 @@ float UObject::STATIC_Subtract_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5360,13 +4647,8 @@ float UObject::STATIC_Add_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5386,13 +4668,8 @@ float UObject::STATIC_Percent_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5412,13 +4689,8 @@ float UObject::STATIC_Divide_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5438,13 +4710,8 @@ float UObject::STATIC_Multiply_FloatFloat(float A, float B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5464,13 +4731,8 @@ float UObject::STATIC_MultiplyMultiply_FloatFloat(float Base, float Exp)
 	params.Base = Base;
 	params.Exp = Exp;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5488,13 +4750,8 @@ float UObject::STATIC_Subtract_PreFloat(float A)
 	UObject_Subtract_PreFloat_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5512,13 +4769,8 @@ struct FString UObject::STATIC_ToHex(int A)
 	UObject_ToHex_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5540,13 +4792,8 @@ int UObject::STATIC_Clamp(int V, int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5566,13 +4813,8 @@ int UObject::STATIC_Max(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5592,13 +4834,8 @@ int UObject::STATIC_Min(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5616,13 +4853,8 @@ int UObject::STATIC_Rand(int Max)
 	UObject_Rand_Params params;
 	params.Max = Max;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5639,13 +4871,8 @@ int UObject::STATIC_SubtractSubtract_Int(int* A)
 
 	UObject_SubtractSubtract_Int_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5665,13 +4892,8 @@ int UObject::STATIC_AddAdd_Int(int* A)
 
 	UObject_AddAdd_Int_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5691,13 +4913,8 @@ int UObject::STATIC_SubtractSubtract_PreInt(int* A)
 
 	UObject_SubtractSubtract_PreInt_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5717,13 +4934,8 @@ int UObject::STATIC_AddAdd_PreInt(int* A)
 
 	UObject_AddAdd_PreInt_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5745,13 +4957,8 @@ int UObject::STATIC_SubtractEqual_IntInt(int B, int* A)
 	UObject_SubtractEqual_IntInt_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5773,13 +4980,8 @@ int UObject::STATIC_AddEqual_IntInt(int B, int* A)
 	UObject_AddEqual_IntInt_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5801,13 +5003,8 @@ int UObject::STATIC_DivideEqual_IntFloat(float B, int* A)
 	UObject_DivideEqual_IntFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5829,13 +5026,8 @@ int UObject::STATIC_MultiplyEqual_IntFloat(float B, int* A)
 	UObject_MultiplyEqual_IntFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -5858,13 +5050,8 @@ int UObject::STATIC_Or_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5884,13 +5071,8 @@ int UObject::STATIC_Xor_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5910,13 +5092,8 @@ int UObject::STATIC_And_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5936,13 +5113,8 @@ bool UObject::STATIC_NotEqual_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5962,13 +5134,8 @@ bool UObject::STATIC_EqualEqual_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5988,13 +5155,8 @@ bool UObject::STATIC_GreaterEqual_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6014,13 +5176,8 @@ bool UObject::STATIC_LessEqual_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6040,13 +5197,8 @@ bool UObject::STATIC_Greater_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6066,13 +5218,8 @@ bool UObject::STATIC_Less_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6092,13 +5239,8 @@ int UObject::STATIC_GreaterGreaterGreater_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6118,13 +5260,8 @@ int UObject::STATIC_GreaterGreater_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6144,13 +5281,8 @@ int UObject::STATIC_LessLess_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6170,13 +5302,8 @@ int UObject::STATIC_Subtract_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6196,13 +5323,8 @@ int UObject::STATIC_Add_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6222,13 +5344,8 @@ int UObject::STATIC_Divide_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6248,13 +5365,8 @@ int UObject::STATIC_Multiply_IntInt(int A, int B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6272,13 +5384,8 @@ int UObject::STATIC_Subtract_PreInt(int A)
 	UObject_Subtract_PreInt_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6296,13 +5403,8 @@ int UObject::STATIC_Complement_PreInt(int A)
 	UObject_Complement_PreInt_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6319,13 +5421,8 @@ unsigned char UObject::STATIC_SubtractSubtract_Byte(unsigned char* A)
 
 	UObject_SubtractSubtract_Byte_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -6345,13 +5442,8 @@ unsigned char UObject::STATIC_AddAdd_Byte(unsigned char* A)
 
 	UObject_AddAdd_Byte_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -6371,13 +5463,8 @@ unsigned char UObject::STATIC_SubtractSubtract_PreByte(unsigned char* A)
 
 	UObject_SubtractSubtract_PreByte_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -6397,13 +5484,8 @@ unsigned char UObject::STATIC_AddAdd_PreByte(unsigned char* A)
 
 	UObject_AddAdd_PreByte_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -6425,13 +5507,8 @@ unsigned char UObject::STATIC_SubtractEqual_ByteByte(unsigned char B, unsigned c
 	UObject_SubtractEqual_ByteByte_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -6453,13 +5530,8 @@ unsigned char UObject::STATIC_AddEqual_ByteByte(unsigned char B, unsigned char*
 	UObject_AddEqual_ByteByte_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -6481,13 +5553,8 @@ unsigned char UObject::STATIC_DivideEqual_ByteByte(unsigned char B, unsigned cha
 	UObject_DivideEqual_ByteByte_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -6509,13 +5576,8 @@ unsigned char UObject::STATIC_MultiplyEqual_ByteFloat(float B, unsigned char* A)
 	UObject_MultiplyEqual_ByteFloat_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -6537,13 +5599,8 @@ unsigned char UObject::STATIC_MultiplyEqual_ByteByte(unsigned char B, unsigned c
 	UObject_MultiplyEqual_ByteByte_Params params;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (A != nullptr)
 		*A = params.A;
 
@@ -6566,13 +5623,8 @@ bool UObject::STATIC_OrOr_BoolBool(bool A, bool B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6592,13 +5644,8 @@ bool UObject::STATIC_XorXor_BoolBool(bool A, bool B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6618,13 +5665,8 @@ bool UObject::STATIC_AndAnd_BoolBool(bool A, bool B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6644,13 +5686,8 @@ bool UObject::STATIC_NotEqual_BoolBool(bool A, bool B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6670,13 +5707,8 @@ bool UObject::STATIC_EqualEqual_BoolBool(bool A, bool B)
 	params.A = A;
 	params.B = B;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6694,13 +5726,8 @@ bool UObject::STATIC_Not_PreBool(bool A)
 	UObject_Not_PreBool_Params params;
 	params.A = A;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6718,13 +5745,8 @@ int UCommandlet::Main(const struct FString& Params)
 	UCommandlet_Main_Params params;
 	params.Params = Params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6742,13 +5764,8 @@ int UHelpCommandlet::Main(const struct FString& Params)
 	UHelpCommandlet_Main_Params params;
 	params.Params = Params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
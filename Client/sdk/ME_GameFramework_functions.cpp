@@ -21,11 +21,7 @@ void AGameBreakableActor::Destroyed()
 
 	AGameBreakableActor_Destroyed_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -38,11 +34,7 @@ void AGameBreakableActor::HideAndDestroy()
 
 	AGameBreakableActor_HideAndDestroy_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -58,11 +50,7 @@ void AGameBreakableActor::BreakLastApart(class AController* EventInstigator)
 	AGameBreakableActor_BreakLastApart_Params params;
 	params.EventInstigator = EventInstigator;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -78,11 +66,7 @@ void AGameBreakableActor::BreakStepApart(int BrokenStep)
 	AGameBreakableActor_BreakStepApart_Params params;
 	params.BrokenStep = BrokenStep;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -99,12 +83,8 @@ bool AGameBreakableActor::IsValidDamageType(class UClass* inDamageType)
 	AGameBreakableActor_IsValidDamageType_Params params;
 	params.inDamageType = inDamageType;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -127,11 +107,7 @@ void AGameBreakableActor::TakeStepDamage(int Damage, class AController* EventIns
 	params.bIsBroken = bIsBroken;
 	params.BrokenStep = BrokenStep;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -153,11 +129,7 @@ void AGameBreakableActor::TakeLastDamage(int Damage, class AController* EventIns
 	params.bIsBroken = bIsBroken;
 	params.BrokenStep = BrokenStep;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -185,11 +157,7 @@ void AGameBreakableActor::TakeDamage(int Damage, class AController* EventInstiga
 	params.HitInfo = HitInfo;
 	params.DamageCauser = DamageCauser;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -205,12 +173,7 @@ void AGameBreakableActor::SetParticlesLighting(class AEmitter* Emit)
 	AGameBreakableActor_SetParticlesLighting_Params params;
 	params.Emit = Emit;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -227,13 +190,8 @@ struct FVector AGameBreakableActor::GetOffsetToWorld(const struct FVector& Offse
 	AGameBreakableActor_GetOffsetToWorld_Params params;
 	params.Offset = Offset;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -247,11 +205,7 @@ void AGameHUD::StopDrawingChapterTitle()
 
 	AGameHUD_StopDrawingChapterTitle_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -273,11 +227,7 @@ void AGameHUD::StartDrawingChapterTitle(const struct FString& ChapterName, const
 	params.TotalDrawTime = TotalDrawTime;
 	params.TotalFadeTime = TotalFadeTime;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -295,11 +245,7 @@ void AGameHUD::SetHUDDrawColor(TEnumAsByte<EGameHUDColor> eColor, unsigned char
 	params.eColor = eColor;
 	params.Alpha = Alpha;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -315,12 +261,8 @@ void AGamePawn::GetTargetFrictionCylinder(float* CylinderRadius, float* Cylinder
 
 	AGamePawn_GetTargetFrictionCylinder_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (CylinderRadius != nullptr)
 		*CylinderRadius = params.CylinderRadius;
 	if (CylinderHeight != nullptr)
@@ -344,11 +286,7 @@ void AGamePlayerController::ClientDisplayChapterTitle(int DisplayChapter, float
 	params.TotalDisplayTime = TotalDisplayTime;
 	params.TotalFadeTime = TotalFadeTime;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -368,11 +306,7 @@ void AGamePlayerController::DisplayChapterTitle(int DisplayChapter, float TotalD
 	params.TotalDisplayTime = TotalDisplayTime;
 	params.TotalFadeTime = TotalFadeTime;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -390,13 +324,8 @@ void AGamePlayerController::GetChapterStrings(int eChapter, struct FString* Chap
 	AGamePlayerController_GetChapterStrings_Params params;
 	params.eChapter = eChapter;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (ChapterName != nullptr)
 		*ChapterName = params.ChapterName;
 	if (ActName != nullptr)
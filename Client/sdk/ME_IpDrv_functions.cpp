@@ -25,12 +25,8 @@ struct FUniqueNetId UOnlineSubsystemCommonImpl::GetPlayerUniqueNetIdFromIndex(in
 	UOnlineSubsystemCommonImpl_GetPlayerUniqueNetIdFromIndex_Params params;
 	params.UserIndex = UserIndex;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -48,12 +44,8 @@ struct FString UOnlineSubsystemCommonImpl::GetPlayerNicknameFromIndex(int UserIn
 	UOnlineSubsystemCommonImpl_GetPlayerNicknameFromIndex_Params params;
 	params.UserIndex = UserIndex;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -70,12 +62,8 @@ bool UOnlineGameInterfaceImpl::RecalculateSkillRating(TArray<struct FUniqueNetId
 
 	UOnlineGameInterfaceImpl_RecalculateSkillRating_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Players != nullptr)
 		*Players = params.Players;
 
@@ -96,12 +84,8 @@ bool UOnlineGameInterfaceImpl::AcceptGameInvite(unsigned char LocalUserNum)
 	UOnlineGameInterfaceImpl_AcceptGameInvite_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -118,11 +102,7 @@ void UOnlineGameInterfaceImpl::OnGameInviteAccepted(class UOnlineGameSettings* G
 	UOnlineGameInterfaceImpl_OnGameInviteAccepted_Params params;
 	params.GameInviteSettings = GameInviteSettings;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -140,11 +120,7 @@ void UOnlineGameInterfaceImpl::ClearGameInviteAcceptedDelegate(unsigned char Loc
 	params.LocalUserNum = LocalUserNum;
 	params.GameInviteAcceptedDelegate = GameInviteAcceptedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -162,11 +138,7 @@ void UOnlineGameInterfaceImpl::AddGameInviteAcceptedDelegate(unsigned char Local
 	params.LocalUserNum = LocalUserNum;
 	params.GameInviteAcceptedDelegate = GameInviteAcceptedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -181,12 +153,8 @@ TArray<struct FOnlineArbitrationRegistrant> UOnlineGameInterfaceImpl::GetArbitra
 
 	UOnlineGameInterfaceImpl_GetArbitratedPlayers_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -203,11 +171,7 @@ void UOnlineGameInterfaceImpl::ClearArbitrationRegistrationCompleteDelegate(cons
 	UOnlineGameInterfaceImpl_ClearArbitrationRegistrationCompleteDelegate_Params params;
 	params.ArbitrationRegistrationCompleteDelegate = ArbitrationRegistrationCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -223,11 +187,7 @@ void UOnlineGameInterfaceImpl::AddArbitrationRegistrationCompleteDelegate(const
 	UOnlineGameInterfaceImpl_AddArbitrationRegistrationCompleteDelegate_Params params;
 	params.ArbitrationRegistrationCompleteDelegate = ArbitrationRegistrationCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -243,11 +203,7 @@ void UOnlineGameInterfaceImpl::OnArbitrationRegistrationComplete(bool bWasSucces
 	UOnlineGameInterfaceImpl_OnArbitrationRegistrationComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -262,12 +218,8 @@ bool UOnlineGameInterfaceImpl::RegisterForArbitration()
 
 	UOnlineGameInterfaceImpl_RegisterForArbitration_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -284,11 +236,7 @@ void UOnlineGameInterfaceImpl::ClearEndOnlineGameCompleteDelegate(const struct F
 	UOnlineGameInterfaceImpl_ClearEndOnlineGameCompleteDelegate_Params params;
 	params.EndOnlineGameCompleteDelegate = EndOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -304,11 +252,7 @@ void UOnlineGameInterfaceImpl::AddEndOnlineGameCompleteDelegate(const struct FSc
 	UOnlineGameInterfaceImpl_AddEndOnlineGameCompleteDelegate_Params params;
 	params.EndOnlineGameCompleteDelegate = EndOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -324,11 +268,7 @@ void UOnlineGameInterfaceImpl::OnEndOnlineGameComplete(bool bWasSuccessful)
 	UOnlineGameInterfaceImpl_OnEndOnlineGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -343,13 +283,8 @@ bool UOnlineGameInterfaceImpl::EndOnlineGame()
 
 	UOnlineGameInterfaceImpl_EndOnlineGame_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -366,11 +301,7 @@ void UOnlineGameInterfaceImpl::ClearStartOnlineGameCompleteDelegate(const struct
 	UOnlineGameInterfaceImpl_ClearStartOnlineGameCompleteDelegate_Params params;
 	params.StartOnlineGameCompleteDelegate = StartOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -386,11 +317,7 @@ void UOnlineGameInterfaceImpl::AddStartOnlineGameCompleteDelegate(const struct F
 	UOnlineGameInterfaceImpl_AddStartOnlineGameCompleteDelegate_Params params;
 	params.StartOnlineGameCompleteDelegate = StartOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -406,11 +333,7 @@ void UOnlineGameInterfaceImpl::OnStartOnlineGameComplete(bool bWasSuccessful)
 	UOnlineGameInterfaceImpl_OnStartOnlineGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -425,13 +348,8 @@ bool UOnlineGameInterfaceImpl::StartOnlineGame()
 
 	UOnlineGameInterfaceImpl_StartOnlineGame_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -448,11 +366,7 @@ void UOnlineGameInterfaceImpl::ClearUnregisterPlayerCompleteDelegate(const struc
 	UOnlineGameInterfaceImpl_ClearUnregisterPlayerCompleteDelegate_Params params;
 	params.UnregisterPlayerCompleteDelegate = UnregisterPlayerCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -468,11 +382,7 @@ void UOnlineGameInterfaceImpl::AddUnregisterPlayerCompleteDelegate(const struct
 	UOnlineGameInterfaceImpl_AddUnregisterPlayerCompleteDelegate_Params params;
 	params.UnregisterPlayerCompleteDelegate = UnregisterPlayerCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -488,11 +398,7 @@ void UOnlineGameInterfaceImpl::OnUnregisterPlayerComplete(bool bWasSuccessful)
 	UOnlineGameInterfaceImpl_OnUnregisterPlayerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -509,12 +415,8 @@ bool UOnlineGameInterfaceImpl::UnregisterPlayer(const struct FUniqueNetId& Playe
 	UOnlineGameInterfaceImpl_UnregisterPlayer_Params params;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -531,11 +433,7 @@ void UOnlineGameInterfaceImpl::ClearRegisterPlayerCompleteDelegate(const struct
 	UOnlineGameInterfaceImpl_ClearRegisterPlayerCompleteDelegate_Params params;
 	params.RegisterPlayerCompleteDelegate = RegisterPlayerCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -551,11 +449,7 @@ void UOnlineGameInterfaceImpl::AddRegisterPlayerCompleteDelegate(const struct FS
 	UOnlineGameInterfaceImpl_AddRegisterPlayerCompleteDelegate_Params params;
 	params.RegisterPlayerCompleteDelegate = RegisterPlayerCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -571,11 +465,7 @@ void UOnlineGameInterfaceImpl::OnRegisterPlayerComplete(bool bWasSuccessful)
 	UOnlineGameInterfaceImpl_OnRegisterPlayerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -594,12 +484,8 @@ bool UOnlineGameInterfaceImpl::RegisterPlayer(const struct FUniqueNetId& PlayerI
 	params.PlayerId = PlayerId;
 	params.bWasInvited = bWasInvited;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -616,13 +502,8 @@ bool UOnlineGameInterfaceImpl::GetResolvedConnectString(struct FString* ConnectI
 
 	UOnlineGameInterfaceImpl_GetResolvedConnectString_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (ConnectInfo != nullptr)
 		*ConnectInfo = params.ConnectInfo;
 
@@ -642,11 +523,7 @@ void UOnlineGameInterfaceImpl::ClearJoinOnlineGameCompleteDelegate(const struct
 	UOnlineGameInterfaceImpl_ClearJoinOnlineGameCompleteDelegate_Params params;
 	params.JoinOnlineGameCompleteDelegate = JoinOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -662,11 +539,7 @@ void UOnlineGameInterfaceImpl::AddJoinOnlineGameCompleteDelegate(const struct FS
 	UOnlineGameInterfaceImpl_AddJoinOnlineGameCompleteDelegate_Params params;
 	params.JoinOnlineGameCompleteDelegate = JoinOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -682,11 +555,7 @@ void UOnlineGameInterfaceImpl::OnJoinOnlineGameComplete(bool bWasSuccessful)
 	UOnlineGameInterfaceImpl_OnJoinOnlineGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -704,13 +573,8 @@ bool UOnlineGameInterfaceImpl::JoinOnlineGame(unsigned char PlayerNum, struct FO
 	UOnlineGameInterfaceImpl_JoinOnlineGame_Params params;
 	params.PlayerNum = PlayerNum;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (DesiredGame != nullptr)
 		*DesiredGame = params.DesiredGame;
 
@@ -731,13 +595,8 @@ bool UOnlineGameInterfaceImpl::FreeSearchResults(class UOnlineGameSearch* Search
 	UOnlineGameInterfaceImpl_FreeSearchResults_Params params;
 	params.Search = Search;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -754,11 +613,7 @@ void UOnlineGameInterfaceImpl::ClearCancelFindOnlineGamesCompleteDelegate(const
 	UOnlineGameInterfaceImpl_ClearCancelFindOnlineGamesCompleteDelegate_Params params;
 	params.CancelFindOnlineGamesCompleteDelegate = CancelFindOnlineGamesCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -774,11 +629,7 @@ void UOnlineGameInterfaceImpl::AddCancelFindOnlineGamesCompleteDelegate(const st
 	UOnlineGameInterfaceImpl_AddCancelFindOnlineGamesCompleteDelegate_Params params;
 	params.CancelFindOnlineGamesCompleteDelegate = CancelFindOnlineGamesCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -794,11 +645,7 @@ void UOnlineGameInterfaceImpl::OnCancelFindOnlineGamesComplete(bool bWasSuccessf
 	UOnlineGameInterfaceImpl_OnCancelFindOnlineGamesComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -813,13 +660,8 @@ bool UOnlineGameInterfaceImpl::CancelFindOnlineGames()
 
 	UOnlineGameInterfaceImpl_CancelFindOnlineGames_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -836,11 +678,7 @@ void UOnlineGameInterfaceImpl::ClearFindOnlineGamesCompleteDelegate(const struct
 	UOnlineGameInterfaceImpl_ClearFindOnlineGamesCompleteDelegate_Params params;
 	params.FindOnlineGamesCompleteDelegate = FindOnlineGamesCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -856,11 +694,7 @@ void UOnlineGameInterfaceImpl::AddFindOnlineGamesCompleteDelegate(const struct F
 	UOnlineGameInterfaceImpl_AddFindOnlineGamesCompleteDelegate_Params params;
 	params.FindOnlineGamesCompleteDelegate = FindOnlineGamesCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -879,13 +713,8 @@ bool UOnlineGameInterfaceImpl::FindOnlineGames(unsigned char SearchingPlayerNum,
 	params.SearchingPlayerNum = SearchingPlayerNum;
 	params.SearchSettings = SearchSettings;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -902,11 +731,7 @@ void UOnlineGameInterfaceImpl::ClearDestroyOnlineGameCompleteDelegate(const stru
 	UOnlineGameInterfaceImpl_ClearDestroyOnlineGameCompleteDelegate_Params params;
 	params.DestroyOnlineGameCompleteDelegate = DestroyOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -922,11 +747,7 @@ void UOnlineGameInterfaceImpl::AddDestroyOnlineGameCompleteDelegate(const struct
 	UOnlineGameInterfaceImpl_AddDestroyOnlineGameCompleteDelegate_Params params;
 	params.DestroyOnlineGameCompleteDelegate = DestroyOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -942,11 +763,7 @@ void UOnlineGameInterfaceImpl::OnDestroyOnlineGameComplete(bool bWasSuccessful)
 	UOnlineGameInterfaceImpl_OnDestroyOnlineGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -961,13 +778,8 @@ bool UOnlineGameInterfaceImpl::DestroyOnlineGame()
 
 	UOnlineGameInterfaceImpl_DestroyOnlineGame_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -985,12 +797,8 @@ bool UOnlineGameInterfaceImpl::UpdateOnlineGame(class UOnlineGameSettings* Updat
 	UOnlineGameInterfaceImpl_UpdateOnlineGame_Params params;
 	params.UpdatedGameSettings = UpdatedGameSettings;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1007,11 +815,7 @@ void UOnlineGameInterfaceImpl::ClearCreateOnlineGameCompleteDelegate(const struc
 	UOnlineGameInterfaceImpl_ClearCreateOnlineGameCompleteDelegate_Params params;
 	params.CreateOnlineGameCompleteDelegate = CreateOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1027,11 +831,7 @@ void UOnlineGameInterfaceImpl::AddCreateOnlineGameCompleteDelegate(const struct
 	UOnlineGameInterfaceImpl_AddCreateOnlineGameCompleteDelegate_Params params;
 	params.CreateOnlineGameCompleteDelegate = CreateOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1047,11 +847,7 @@ void UOnlineGameInterfaceImpl::OnCreateOnlineGameComplete(bool bWasSuccessful)
 	UOnlineGameInterfaceImpl_OnCreateOnlineGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1070,13 +866,8 @@ bool UOnlineGameInterfaceImpl::CreateOnlineGame(unsigned char HostingPlayerNum,
 	params.HostingPlayerNum = HostingPlayerNum;
 	params.NewGameSettings = NewGameSettings;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1092,12 +883,8 @@ class UOnlineGameSearch* UOnlineGameInterfaceImpl::GetGameSearch()
 
 	UOnlineGameInterfaceImpl_GetGameSearch_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1113,12 +900,8 @@ class UOnlineGameSettings* UOnlineGameInterfaceImpl::GetGameSettings()
 
 	UOnlineGameInterfaceImpl_GetGameSettings_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1134,12 +917,8 @@ TEnumAsByte<EOnlineGameState> UOnlineGameInterfaceImpl::GetOnlineGameState()
 
 	UOnlineGameInterfaceImpl_GetOnlineGameState_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1156,11 +935,7 @@ void UOnlineGameInterfaceImpl::OnFindOnlineGamesComplete(bool bWasSuccessful)
 	UOnlineGameInterfaceImpl_OnFindOnlineGamesComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -33,12 +33,8 @@ struct FString UTdTTVictoryMessage::STATIC_GetString(int InSwitch, bool bPRI1HUD
 	params.RelatedPRI_3 = RelatedPRI_3;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -63,11 +59,7 @@ void UTdTTVictoryMessage::STATIC_ClientReceive(class APlayerController* P, int S
 	params.RecieverPRI = RecieverPRI;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -84,12 +76,8 @@ float UTdTimeTrialMessage::STATIC_GetLifeTime(int Switch)
 	UTdTimeTrialMessage_GetLifeTime_Params params;
 	params.Switch = Switch;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -115,12 +103,8 @@ struct FString UTdTimeTrialMessage::STATIC_GetString(int InSwitch, bool bPRI1HUD
 	params.RelatedPRI_3 = RelatedPRI_3;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -146,12 +130,8 @@ class USoundNodeWave* UTdTimeTrialMessage::STATIC_GetAnnouncementSound(class APl
 	params.RelatedPRI_3 = RelatedPRI_3;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -176,11 +156,7 @@ void UTdTimeTrialMessage::STATIC_ClientReceive(class APlayerController* P, int S
 	params.RecieverPRI = RecieverPRI;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -203,12 +179,8 @@ struct FColor UTdTimeMessage::STATIC_GetColor(int Switch, class APlayerReplicati
 	params.RelatedPRI_3 = RelatedPRI_3;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -234,12 +206,8 @@ struct FString UTdTimeMessage::STATIC_GetString(int InSwitch, bool bPRI1HUD, cla
 	params.RelatedPRI_3 = RelatedPRI_3;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -265,12 +233,8 @@ class USoundNodeWave* UTdTimeMessage::STATIC_GetAnnouncementSound(class APlayerC
 	params.RelatedPRI_3 = RelatedPRI_3;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -295,11 +259,7 @@ void UTdTimeMessage::STATIC_ClientReceive(class APlayerController* P, int Switch
 	params.RecieverPRI = RecieverPRI;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -324,12 +284,8 @@ class USoundNodeWave* UTdFinishlineTimeMessage::STATIC_GetAnnouncementSound(clas
 	params.RelatedPRI_3 = RelatedPRI_3;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -33,12 +33,8 @@ struct FString UTdTutorialMessage::STATIC_GetString(int Switch, bool bPRI1HUD, c
 	params.Victim = Victim;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -64,12 +60,8 @@ struct FString UTdTutorialFeedbackMessage::STATIC_GetString(int InSwitch, bool b
 	params.RelatedPRI_3 = RelatedPRI_3;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -95,12 +87,8 @@ class USoundNodeWave* UTdTutorialFeedbackMessage::STATIC_GetAnnouncementSound(cl
 	params.RelatedPRI_3 = RelatedPRI_3;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -125,11 +113,7 @@ void UTdTutorialFeedbackMessage::STATIC_ClientReceive(class APlayerController* P
 	params.RecieverPRI = RecieverPRI;
 	params.OptionalObject = OptionalObject;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
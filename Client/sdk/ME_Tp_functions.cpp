@@ -21,11 +21,7 @@ void UTpSystemHandler::Finalize()
 
 	UTpSystemHandler_Finalize_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -41,11 +37,7 @@ void UTpSystemHandler::Initialize(class UTpSystemBase* InSystemBase)
 	UTpSystemHandler_Initialize_Params params;
 	params.InSystemBase = InSystemBase;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -58,12 +50,7 @@ void UTpSystemHandler::FinalizeNative()
 
 	UTpSystemHandler_FinalizeNative_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -76,12 +63,7 @@ void UTpSystemHandler::InitializeNative()
 
 	UTpSystemHandler_InitializeNative_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -98,13 +80,8 @@ bool UTpAchievementManager::ShowXBOXAchievementsUI(unsigned char LocalUserNum)
 	UTpAchievementManager_ShowXBOXAchievementsUI_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -118,11 +95,7 @@ void UTpAchievementManager::OnGrantAward()
 
 	UTpAchievementManager_OnGrantAward_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -137,13 +110,8 @@ void UTpAchievementManager::GrantAward(struct FAchBind* Award)
 
 	UTpAchievementManager_GrantAward_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Award != nullptr)
 		*Award = params.Award;
 }
@@ -160,13 +128,8 @@ bool UTpAssociationManager::IsFriendsListLoaded()
 
 	UTpAssociationManager_IsFriendsListLoaded_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -180,11 +143,7 @@ void UTpAssociationManager::OnFriendsListChange()
 
 	UTpAssociationManager_OnFriendsListChange_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -200,11 +159,7 @@ void UTpAssociationManager::OnFriendsListLoaded(bool bInOk)
 	UTpAssociationManager_OnFriendsListLoaded_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -220,11 +175,7 @@ void UTpAssociationManager::OnAddMember(bool bInOk)
 	UTpAssociationManager_OnAddMember_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -240,11 +191,7 @@ void UTpAssociationManager::OnRemoveMember(bool bInOk)
 	UTpAssociationManager_OnRemoveMember_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -259,13 +206,8 @@ TArray<struct FString> UTpAssociationManager::ListBlockedUsers()
 
 	UTpAssociationManager_ListBlockedUsers_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -283,13 +225,8 @@ bool UTpAssociationManager::UnBlockUserAsync(const struct FUniqueNetId& UserRef)
 	UTpAssociationManager_UnBlockUserAsync_Params params;
 	params.UserRef = UserRef;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -307,13 +244,8 @@ bool UTpAssociationManager::BlockUserAsync(const struct FUniqueNetId& UserRef)
 	UTpAssociationManager_BlockUserAsync_Params params;
 	params.UserRef = UserRef;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -331,13 +263,8 @@ bool UTpAssociationManager::IsFriend(const struct FUniqueNetId& PlayerId)
 	UTpAssociationManager_IsFriend_Params params;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -358,13 +285,8 @@ bool UTpAssociationManager::GetPlayersList(int Count, int StartingAt, TArray<str
 	params.Count = Count;
 	params.StartingAt = StartingAt;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Players != nullptr)
 		*Players = params.Players;
 
@@ -390,13 +312,8 @@ bool UTpAssociationManager::GetMyFriendsListEx(unsigned char LocalUserNum, int C
 	params.Count = Count;
 	params.StartingAt = StartingAt;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Friends != nullptr)
 		*Friends = params.Friends;
 
@@ -415,13 +332,8 @@ TArray<struct FString> UTpAssociationManager::GetMyFriendsList()
 
 	UTpAssociationManager_GetMyFriendsList_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -439,13 +351,8 @@ bool UTpAssociationManager::RemoveFriendAsync(const struct FUniqueNetId& FormerF
 	UTpAssociationManager_RemoveFriendAsync_Params params;
 	params.FormerFriend = FormerFriend;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -462,12 +369,7 @@ void UTpAssociationManager::AddFriendAsync(const struct FUniqueNetId& NewFriend)
 	UTpAssociationManager_AddFriendAsync_Params params;
 	params.NewFriend = NewFriend;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -482,13 +384,8 @@ bool UTpConnection::IsLoggedIn()
 
 	UTpConnection_IsLoggedIn_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -504,13 +401,8 @@ bool UTpConnection::IsConnected()
 
 	UTpConnection_IsConnected_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -526,12 +418,8 @@ bool UTpConnection::IsLanGame()
 
 	UTpConnection_IsLanGame_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -547,13 +435,8 @@ bool UTpConnection::IsAuthenticated()
 
 	UTpConnection_IsAuthenticated_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -570,12 +453,7 @@ void UTpConnection::SetActiveControllerId(unsigned char LocalUserNum)
 	UTpConnection_SetActiveControllerId_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -588,12 +466,7 @@ void UTpConnection::RepromptDisplay()
 
 	UTpConnection_RepromptDisplay_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -606,11 +479,7 @@ void UTpConnection::OnDisplayParentalEmail()
 
 	UTpConnection_OnDisplayParentalEmail_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -626,12 +495,7 @@ void UTpConnection::ConfirmParentalEmail(const struct FString& Email)
 	UTpConnection_ConfirmParentalEmail_Params params;
 	params.Email = Email;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -647,11 +511,7 @@ void UTpConnection::OnDisplayConfirmMessage(const struct FString& Message)
 	UTpConnection_OnDisplayConfirmMessage_Params params;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -664,12 +524,7 @@ void UTpConnection::ConfirmMessage()
 
 	UTpConnection_ConfirmMessage_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -682,11 +537,7 @@ void UTpConnection::OnDisconnect()
 
 	UTpConnection_OnDisconnect_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -699,12 +550,7 @@ void UTpConnection::DisconnectAsync()
 
 	UTpConnection_DisconnectAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -720,11 +566,7 @@ void UTpConnection::OnCreatePersonaError(int ErrorCode)
 	UTpConnection_OnCreatePersonaError_Params params;
 	params.ErrorCode = ErrorCode;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -740,12 +582,7 @@ void UTpConnection::CreatePersonaAsync(const struct FString& Persona)
 	UTpConnection_CreatePersonaAsync_Params params;
 	params.Persona = Persona;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -761,11 +598,7 @@ void UTpConnection::OnDisplayPersonas(TArray<struct FString> Personas)
 	UTpConnection_OnDisplayPersonas_Params params;
 	params.Personas = Personas;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -781,12 +614,7 @@ void UTpConnection::CreateAccountAcceptTOSAsync(bool Accept)
 	UTpConnection_CreateAccountAcceptTOSAsync_Params params;
 	params.Accept = Accept;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -802,11 +630,7 @@ void UTpConnection::OnGetTOS(const struct FString& TOSText)
 	UTpConnection_OnGetTOS_Params params;
 	params.TOSText = TOSText;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -822,12 +646,7 @@ void UTpConnection::CreateAccountGetTOSAsync(const struct FString& ISOCode)
 	UTpConnection_CreateAccountGetTOSAsync_Params params;
 	params.ISOCode = ISOCode;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -843,11 +662,7 @@ void UTpConnection::OnDisplayCountrySelect(TArray<struct FTpCreateAccountCountry
 	UTpConnection_OnDisplayCountrySelect_Params params;
 	params.Countries = Countries;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -863,11 +678,7 @@ void UTpConnection::OnCreateAccountError(TEnumAsByte<ETpAccountError> InError)
 	UTpConnection_OnCreateAccountError_Params params;
 	params.InError = InError;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -889,12 +700,7 @@ void UTpConnection::CreateAccountConsoleAsync(const struct FString& Email, const
 	params.bAllowEaEmail = bAllowEaEmail;
 	params.bAllowThirdPartyEmail = bAllowThirdPartyEmail;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -911,13 +717,8 @@ bool UTpConnection::CreateAccountAsync(const struct FTpCreateAccountParams& InPa
 	UTpConnection_CreateAccountAsync_Params params;
 	params.InParams = InParams;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -942,11 +743,7 @@ void UTpConnection::OnCreateAccountReady(const struct FString& Email, const stru
 	params.bAllowTPEmail = bAllowTPEmail;
 	params.bIsConsole = bIsConsole;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -959,12 +756,7 @@ void UTpConnection::PrepareCreateAccountAsync()
 
 	UTpConnection_PrepareCreateAccountAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -980,11 +772,7 @@ void UTpConnection::OnLoginPersonaError(int ErrorCode)
 	UTpConnection_OnLoginPersonaError_Params params;
 	params.ErrorCode = ErrorCode;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1000,11 +788,7 @@ void UTpConnection::OnLoginAccountError(TEnumAsByte<ETpAccountError> InError)
 	UTpConnection_OnLoginAccountError_Params params;
 	params.InError = InError;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1020,11 +804,7 @@ void UTpConnection::OnPartiallyLoggedIn(TArray<struct FString> InSubNames)
 	UTpConnection_OnPartiallyLoggedIn_Params params;
 	params.InSubNames = InSubNames;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1040,12 +820,7 @@ void UTpConnection::LoginPersonaAsync(const struct FString& InName)
 	UTpConnection_LoginPersonaAsync_Params params;
 	params.InName = InName;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1061,12 +836,7 @@ void UTpConnection::LoginEncAccountAsync(const struct FString& EncLogin)
 	UTpConnection_LoginEncAccountAsync_Params params;
 	params.EncLogin = EncLogin;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1084,12 +854,7 @@ void UTpConnection::LoginAccountAsync(const struct FString& InName, const struct
 	params.InName = InName;
 	params.InPasswd = InPasswd;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1105,11 +870,7 @@ void UTpConnection::OnConnectionChange(bool bConnected)
 	UTpConnection_OnConnectionChange_Params params;
 	params.bConnected = bConnected;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1122,11 +883,7 @@ void UTpConnection::OnLoginReady()
 
 	UTpConnection_OnLoginReady_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1144,11 +901,7 @@ void UTpConnection::OnConnectionReady(const struct FString& EncLogin, const stru
 	params.EncLogin = EncLogin;
 	params.Persona = Persona;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1164,11 +917,7 @@ void UTpConnection::OnConnectionFailed(TEnumAsByte<ETpConnectionError> InError)
 	UTpConnection_OnConnectionFailed_Params params;
 	params.InError = InError;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1186,12 +935,7 @@ void UTpConnection::ConnectSilentAsync(const struct FString& EncLogin, const str
 	params.EncLogin = EncLogin;
 	params.Persona = Persona;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1204,12 +948,7 @@ void UTpConnection::ConnectAsync()
 
 	UTpConnection_ConnectAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1225,12 +964,7 @@ void UTpConnectParams::InitializeAuthentication(TEnumAsByte<ETpLoginMode> InLogi
 	UTpConnectParams_InitializeAuthentication_Params params;
 	params.InLoginMode = InLoginMode;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1245,13 +979,8 @@ struct FString UTpConnectParams::GetUnauthenticatedPlayerName()
 
 	UTpConnectParams_GetUnauthenticatedPlayerName_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1268,12 +997,7 @@ void UTpConnectParams::SetUnauthenticatedPlayerName(const struct FString& InName
 	UTpConnectParams_SetUnauthenticatedPlayerName_Params params;
 	params.InName = InName;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1288,13 +1012,8 @@ TEnumAsByte<ETpConnectMode> UTpConnectParams::GetConnectMode()
 
 	UTpConnectParams_GetConnectMode_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1311,12 +1030,7 @@ void UTpConnectParams::SetConnectMode(TEnumAsByte<ETpConnectMode> InMode)
 	UTpConnectParams_SetConnectMode_Params params;
 	params.InMode = InMode;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1331,13 +1045,8 @@ struct FPointer UTpConnectParams::GetOpaqueFeslPointer()
 
 	UTpConnectParams_GetOpaqueFeslPointer_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1354,12 +1063,7 @@ void UTpCreateGameParams::SetHostMigrationEnabled(bool bInEnabled)
 	UTpCreateGameParams_SetHostMigrationEnabled_Params params;
 	params.bInEnabled = bInEnabled;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1375,12 +1079,7 @@ void UTpCreateGameParams::SetInviteStatus(TEnumAsByte<ETpInviteStatus> InStatus)
 	UTpCreateGameParams_SetInviteStatus_Params params;
 	params.InStatus = InStatus;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1396,12 +1095,7 @@ void UTpCreateGameParams::SetJoinViaPresenceEnabled(bool bInEnabled)
 	UTpCreateGameParams_SetJoinViaPresenceEnabled_Params params;
 	params.bInEnabled = bInEnabled;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1417,12 +1111,7 @@ void UTpCreateGameParams::SetJoinInProgressEnabled(bool bInEnabled)
 	UTpCreateGameParams_SetJoinInProgressEnabled_Params params;
 	params.bInEnabled = bInEnabled;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1438,12 +1127,7 @@ void UTpCreateGameParams::SetRanked(bool bInRanked)
 	UTpCreateGameParams_SetRanked_Params params;
 	params.bInRanked = bInRanked;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1459,12 +1143,7 @@ void UTpCreateGameParams::SetPasswordUsed(bool bInUsed)
 	UTpCreateGameParams_SetPasswordUsed_Params params;
 	params.bInUsed = bInUsed;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1482,12 +1161,7 @@ void UTpCreateGameParams::SetPlayerTypeCapacity(TEnumAsByte<ETpPlayerType> InTyp
 	params.InType = InType;
 	params.InCapacity = InCapacity;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1503,12 +1177,7 @@ void UTpCreateGameParams::SetGameName(const struct FString& InName)
 	UTpCreateGameParams_SetGameName_Params params;
 	params.InName = InName;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1523,13 +1192,8 @@ struct FPointer UTpCreateGameParams::GetOpaqueFeslPointer()
 
 	UTpCreateGameParams_GetOpaqueFeslPointer_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1545,13 +1209,8 @@ TArray<struct FOnlineFileLockerFileInfo> UTpFileLockerService::ListFileLocker()
 
 	UTpFileLockerService_ListFileLocker_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1568,11 +1227,7 @@ void UTpFileLockerService::OnDeleteFileFromLockerComplete(bool bWasSuccessful)
 	UTpFileLockerService_OnDeleteFileFromLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1588,13 +1243,8 @@ bool UTpFileLockerService::DeleteFileFromLocker(struct FOnlineFileLockerFile* Fi
 
 	UTpFileLockerService_DeleteFileFromLocker_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (FileInfo != nullptr)
 		*FileInfo = params.FileInfo;
 
@@ -1614,11 +1264,7 @@ void UTpFileLockerService::OnWriteFileToLockerComplete(bool bWasSuccessful)
 	UTpFileLockerService_OnWriteFileToLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1634,13 +1280,8 @@ bool UTpFileLockerService::WriteFileToLocker(struct FOnlineFileLockerFile* File)
 
 	UTpFileLockerService_WriteFileToLocker_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (File != nullptr)
 		*File = params.File;
 
@@ -1660,11 +1301,7 @@ void UTpFileLockerService::OnReadFileFromLockerComplete(bool bWasSuccessful)
 	UTpFileLockerService_OnReadFileFromLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1680,13 +1317,8 @@ bool UTpFileLockerService::ReadFileFromLocker(struct FOnlineFileLockerFile* File
 
 	UTpFileLockerService_ReadFileFromLocker_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (File != nullptr)
 		*File = params.File;
 
@@ -1706,11 +1338,7 @@ void UTpFileLockerService::OnFetchLockerComplete(bool bWasSuccessful)
 	UTpFileLockerService_OnFetchLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1727,13 +1355,8 @@ bool UTpFileLockerService::FetchLocker(const struct FString& UserName)
 	UTpFileLockerService_FetchLocker_Params params;
 	params.UserName = UserName;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1750,12 +1373,7 @@ void UTpFileLockerService::Update(float DeltaSeconds)
 	UTpFileLockerService_Update_Params params;
 	params.DeltaSeconds = DeltaSeconds;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1771,11 +1389,7 @@ void UTpProtoHTTP::OnGetVersion(const struct FString& Version)
 	UTpProtoHTTP_OnGetVersion_Params params;
 	params.Version = Version;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1791,12 +1405,7 @@ void UTpProtoHTTP::GetCurrentVersion(const struct FString& Param)
 	UTpProtoHTTP_GetCurrentVersion_Params params;
 	params.Param = Param;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1812,12 +1421,7 @@ void UTpProtoHTTP::Update(float DeltaSeconds)
 	UTpProtoHTTP_Update_Params params;
 	params.DeltaSeconds = DeltaSeconds;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1832,12 +1436,8 @@ struct FTpPlayNowJoinGameInfo UTpGameBrowser::GetPlayNowJoinGameInfo()
 
 	UTpGameBrowser_GetPlayNowJoinGameInfo_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1853,12 +1453,8 @@ struct FTpPlayNowCreateGameInfo UTpGameBrowser::GetPlayNowCreateGameInfo()
 
 	UTpGameBrowser_GetPlayNowCreateGameInfo_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1878,13 +1474,8 @@ struct FTpGameRef UTpGameBrowser::GetGameByIndex(const struct FTpLobbyRef& InLob
 	params.InLobby = InLobby;
 	params.InIndex = InIndex;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -1901,12 +1492,7 @@ void UTpGameBrowser::DropGameList(const struct FTpLobbyRef& InLobby)
 	UTpGameBrowser_DropGameList_Params params;
 	params.InLobby = InLobby;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1922,12 +1508,7 @@ void UTpGameBrowser::FindGameAsync(const struct FTpPlayNowParams& Params)
 	UTpGameBrowser_FindGameAsync_Params params;
 	params.Params = Params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1945,11 +1526,7 @@ void UTpGameBrowser::OnPlayNowMatched(bool bIsServer, int InError)
 	params.bIsServer = bIsServer;
 	params.InError = InError;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1962,11 +1539,7 @@ void UTpGameBrowser::OnPlayNowStarted()
 
 	UTpGameBrowser_OnPlayNowStarted_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1982,12 +1555,7 @@ void UTpGameBrowser::StartQuickMatchAsync(const struct FTpPlayNowParams& Params)
 	UTpGameBrowser_StartQuickMatchAsync_Params params;
 	params.Params = Params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2003,11 +1571,7 @@ void UTpGameBrowser::OnUpdateGameList(bool bInOk)
 	UTpGameBrowser_OnUpdateGameList_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2025,13 +1589,8 @@ void UTpGameBrowser::UpdateGameListAsync(const struct FTpLobbyRef& InLobby, stru
 	UTpGameBrowser_UpdateGameListAsync_Params params;
 	params.InLobby = InLobby;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (InParams != nullptr)
 		*InParams = params.InParams;
 	if (InFavourites != nullptr)
@@ -2052,13 +1611,8 @@ struct FTpLobbyRef UTpGameBrowser::GetLobbyByIndex(int InIndex)
 	UTpGameBrowser_GetLobbyByIndex_Params params;
 	params.InIndex = InIndex;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2072,12 +1626,7 @@ void UTpGameBrowser::DropLobbyList()
 
 	UTpGameBrowser_DropLobbyList_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2093,11 +1642,7 @@ void UTpGameBrowser::OnUpdateLobbyList(bool bInOk)
 	UTpGameBrowser_OnUpdateLobbyList_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2113,13 +1658,8 @@ void UTpGameBrowser::UpdateLobbyListAsync(struct FTpLobbyListParams* InParams, s
 
 	UTpGameBrowser_UpdateLobbyListAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (InParams != nullptr)
 		*InParams = params.InParams;
 	if (InFavourites != nullptr)
@@ -2136,12 +1676,7 @@ void UTpGameManager::DisarmConnectionPlayerControllers()
 
 	UTpGameManager_DisarmConnectionPlayerControllers_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2156,13 +1691,8 @@ struct FString UTpGameManager::GetGameHostIp()
 
 	UTpGameManager_GetGameHostIp_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2176,11 +1706,7 @@ void UTpGameManager::OnLeaveGame()
 
 	UTpGameManager_OnLeaveGame_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2193,12 +1719,7 @@ void UTpGameManager::LeaveGameAsync()
 
 	UTpGameManager_LeaveGameAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2216,11 +1737,7 @@ void UTpGameManager::OnJoinGame(bool bInOk, const struct FString& hostIp)
 	params.bInOk = bInOk;
 	params.hostIp = hostIp;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2236,12 +1753,7 @@ void UTpGameManager::JoinPlayNowGameAsync(const struct FTpPlayNowJoinGameInfo& I
 	UTpGameManager_JoinPlayNowGameAsync_Params params;
 	params.Info = Info;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2259,12 +1771,7 @@ void UTpGameManager::JoinGameAsync(const struct FTpLobbyRef& InLobby, const stru
 	params.InLobby = InLobby;
 	params.InGame = InGame;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2280,11 +1787,7 @@ void UTpGameManager::OnEndGame(bool bInOk)
 	UTpGameManager_OnEndGame_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2297,12 +1800,7 @@ void UTpGameManager::EndGameAsync()
 
 	UTpGameManager_EndGameAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2318,11 +1816,7 @@ void UTpGameManager::OnStartGame(bool bInOk)
 	UTpGameManager_OnStartGame_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2335,12 +1829,7 @@ void UTpGameManager::StartGameAsync()
 
 	UTpGameManager_StartGameAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2356,11 +1845,7 @@ void UTpGameManager::OnDestroyGame(bool bInOk)
 	UTpGameManager_OnDestroyGame_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2373,12 +1858,7 @@ void UTpGameManager::DestroyGameAsync()
 
 	UTpGameManager_DestroyGameAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2394,11 +1874,7 @@ void UTpGameManager::OnCreateGame(bool bInOk)
 	UTpGameManager_OnCreateGame_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2414,12 +1890,7 @@ void UTpGameManager::CreatePlayNowGameAsync(const struct FTpPlayNowCreateGameInf
 	UTpGameManager_CreatePlayNowGameAsync_Params params;
 	params.Info = Info;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2435,12 +1906,7 @@ void UTpGameManager::CreateGameAsync(class UTpCreateGameParams* InParams)
 	UTpGameManager_CreateGameAsync_Params params;
 	params.InParams = InParams;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2455,13 +1921,8 @@ class UTpCreateGameParams* UTpGameManager::NewCreateGameParams()
 
 	UTpGameManager_NewCreateGameParams_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2479,13 +1940,8 @@ bool UTpMessageService::InviteToPlayGroupResponse(const struct FUniqueNetId& Req
 	UTpMessageService_InviteToPlayGroupResponse_Params params;
 	params.RequestingPlayer = RequestingPlayer;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2502,11 +1958,7 @@ void UTpMessageService::OnInviteToPlayGroupReceived(const struct FUniqueNetId& R
 	UTpMessageService_OnInviteToPlayGroupReceived_Params params;
 	params.RequestingPlayer = RequestingPlayer;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2522,11 +1974,7 @@ void UTpMessageService::OnInviteToPlayGroupSent(bool bWasSuccessful)
 	UTpMessageService_OnInviteToPlayGroupSent_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2543,13 +1991,8 @@ bool UTpMessageService::PlayGroupInviteAsync(const struct FUniqueNetId& User)
 	UTpMessageService_PlayGroupInviteAsync_Params params;
 	params.User = User;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2566,11 +2009,7 @@ void UTpMessageService::OnRemoveMessage(bool bInOk)
 	UTpMessageService_OnRemoveMessage_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2587,13 +2026,8 @@ bool UTpMessageService::RemoveMessage(int MessageIndex)
 	UTpMessageService_RemoveMessage_Params params;
 	params.MessageIndex = MessageIndex;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2609,13 +2043,8 @@ void UTpMessageService::GetFriendMessages(TArray<struct FOnlineFriendMessage>* F
 
 	UTpMessageService_GetFriendMessages_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (FriendMessages != nullptr)
 		*FriendMessages = params.FriendMessages;
 }
@@ -2633,11 +2062,7 @@ void UTpMessageService::OnSendMessage(bool bInOk)
 	UTpMessageService_OnSendMessage_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2656,13 +2081,8 @@ bool UTpMessageService::SendMessageAsync(const struct FUniqueNetId& PlayerId, co
 	params.PlayerId = PlayerId;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2681,11 +2101,7 @@ void UTpMessageService::OnFriendRequestDelegate(const struct FUniqueNetId& Sende
 	params.Sender = Sender;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2703,11 +2119,7 @@ void UTpMessageService::OnNewMessage(const struct FUniqueNetId& Sender, const st
 	params.Sender = Sender;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2723,11 +2135,7 @@ void UTpMessageService::OnFriendRequestSent(bool bInOk)
 	UTpMessageService_OnFriendRequestSent_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2744,13 +2152,8 @@ bool UTpMessageService::FriendResponse(const struct FUniqueNetId& NewFriend)
 	UTpMessageService_FriendResponse_Params params;
 	params.NewFriend = NewFriend;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2770,13 +2173,8 @@ bool UTpMessageService::FriendRequestAsync(const struct FUniqueNetId& NewFriend,
 	params.NewFriend = NewFriend;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2790,11 +2188,7 @@ void UTpMessageService::OnCheckInbox()
 
 	UTpMessageService_OnCheckInbox_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2809,13 +2203,8 @@ bool UTpMessageService::CheckInboxAsync()
 
 	UTpMessageService_CheckInboxAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -2832,12 +2221,7 @@ void UTpMessageService::Update(float DeltaSeconds)
 	UTpMessageService_Update_Params params;
 	params.DeltaSeconds = DeltaSeconds;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2850,11 +2234,7 @@ void UTpPlayGroupManager::OnPlayGroupGameLeave()
 
 	UTpPlayGroupManager_OnPlayGroupGameLeave_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2872,11 +2252,7 @@ void UTpPlayGroupManager::OnPlayGroupGameJoined(const struct FTpLobbyRef& InLobb
 	params.InLobby = InLobby;
 	params.InGame = InGame;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2889,11 +2265,7 @@ void UTpPlayGroupManager::OnPlayGroupOwnerTransitionFinish()
 
 	UTpPlayGroupManager_OnPlayGroupOwnerTransitionFinish_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2906,11 +2278,7 @@ void UTpPlayGroupManager::OnPlayGroupOwnerTransitionStart()
 
 	UTpPlayGroupManager_OnPlayGroupOwnerTransitionStart_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2926,12 +2294,7 @@ void UTpPlayGroupManager::TransferOwnerShipAsync(const struct FUniqueNetId& NewO
 	UTpPlayGroupManager_TransferOwnerShipAsync_Params params;
 	params.NewOwnerId = NewOwnerId;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2949,11 +2312,7 @@ void UTpPlayGroupManager::OnPlayGroupMemberLeave(const struct FUniqueNetId& User
 	params.UserId = UserId;
 	params.Reason = Reason;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2966,11 +2325,7 @@ void UTpPlayGroupManager::OnLeavePlayGroupComplete()
 
 	UTpPlayGroupManager_OnLeavePlayGroupComplete_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -2983,12 +2338,7 @@ void UTpPlayGroupManager::LeavePlayGroupAsync()
 
 	UTpPlayGroupManager_LeavePlayGroupAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3001,11 +2351,7 @@ void UTpPlayGroupManager::OnPlayGroupKicked()
 
 	UTpPlayGroupManager_OnPlayGroupKicked_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3021,12 +2367,7 @@ void UTpPlayGroupManager::KickMemberAsync(const struct FUniqueNetId& UserId)
 	UTpPlayGroupManager_KickMemberAsync_Params params;
 	params.UserId = UserId;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3039,11 +2380,7 @@ void UTpPlayGroupManager::OnPlayGroupDestroyed()
 
 	UTpPlayGroupManager_OnPlayGroupDestroyed_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3056,12 +2393,7 @@ void UTpPlayGroupManager::DestroyPlayGroupAsync()
 
 	UTpPlayGroupManager_DestroyPlayGroupAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3079,11 +2411,7 @@ void UTpPlayGroupManager::OnPlayGroupChatMessageReceived(const struct FUniqueNet
 	params.SenderId = SenderId;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3099,12 +2427,7 @@ void UTpPlayGroupManager::BroadCastChatMessageAsync(const struct FString& Messag
 	UTpPlayGroupManager_BroadCastChatMessageAsync_Params params;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3120,11 +2443,7 @@ void UTpPlayGroupManager::OnPlayGroupMemberJoin(const struct FUniqueNetId& UserI
 	UTpPlayGroupManager_OnPlayGroupMemberJoin_Params params;
 	params.UserId = UserId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3140,11 +2459,7 @@ void UTpPlayGroupManager::OnPlayGroupJoined(bool bInOk)
 	UTpPlayGroupManager_OnPlayGroupJoined_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3160,12 +2475,7 @@ void UTpPlayGroupManager::JoinPlayGroupAsync(const struct FUniqueNetId& UserId)
 	UTpPlayGroupManager_JoinPlayGroupAsync_Params params;
 	params.UserId = UserId;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3181,11 +2491,7 @@ void UTpPlayGroupManager::OnPlayGroupCreated(bool bInOk)
 	UTpPlayGroupManager_OnPlayGroupCreated_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3201,12 +2507,7 @@ void UTpPlayGroupManager::CreatePlayGroupAsync(const struct FPlayGroupCreatePara
 	UTpPlayGroupManager_CreatePlayGroupAsync_Params params;
 	params.Params = Params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3221,13 +2522,8 @@ TArray<struct FPlayGroupListEntry> UTpPlayGroupManager::GetMyPlayGroupList()
 
 	UTpPlayGroupManager_GetMyPlayGroupList_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3243,13 +2539,8 @@ bool UTpPlayGroupManager::IsPlayGroupOwner()
 
 	UTpPlayGroupManager_IsPlayGroupOwner_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3265,13 +2556,8 @@ bool UTpPlayGroupManager::IsInPlayGroup()
 
 	UTpPlayGroupManager_IsInPlayGroup_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3288,11 +2574,7 @@ void UTpSystemBase::SetOnScreenHandler(class UTpOnScreenErrorHandler* Handler)
 	UTpSystemBase_SetOnScreenHandler_Params params;
 	params.Handler = Handler;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3307,12 +2589,8 @@ struct FTpErrorInfo UTpSystemBase::GetLatestError()
 
 	UTpSystemBase_GetLatestError_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3329,11 +2607,7 @@ void UTpSystemBase::RegisterLatestError(const struct FTpErrorInfo& LatestError)
 	UTpSystemBase_RegisterLatestError_Params params;
 	params.LatestError = LatestError;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3346,11 +2620,7 @@ void UTpSystemBase::ImpelGameJoined()
 
 	UTpSystemBase_ImpelGameJoined_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3363,11 +2633,7 @@ void UTpSystemBase::ImpelGameDestroyed()
 
 	UTpSystemBase_ImpelGameDestroyed_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3380,11 +2646,7 @@ void UTpSystemBase::ImpelGameCreated()
 
 	UTpSystemBase_ImpelGameCreated_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3397,11 +2659,7 @@ void UTpSystemBase::ImpelDisconnected()
 
 	UTpSystemBase_ImpelDisconnected_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3414,11 +2672,7 @@ void UTpSystemBase::ImpelConnected()
 
 	UTpSystemBase_ImpelConnected_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3433,12 +2687,8 @@ class UTpProtoHTTP* UTpSystemBase::GetProtoHTTP()
 
 	UTpSystemBase_GetProtoHTTP_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3454,12 +2704,8 @@ class UTpFileLockerService* UTpSystemBase::GetFileLockerService()
 
 	UTpSystemBase_GetFileLockerService_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3475,12 +2721,8 @@ class UTpAchievementManager* UTpSystemBase::GetAchievementManager()
 
 	UTpSystemBase_GetAchievementManager_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3496,12 +2738,8 @@ class UTpMessageService* UTpSystemBase::GetMessageService()
 
 	UTpSystemBase_GetMessageService_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3517,12 +2755,8 @@ class UTpGameManager* UTpSystemBase::GetGameManager()
 
 	UTpSystemBase_GetGameManager_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3538,12 +2772,8 @@ class UTpGameBrowser* UTpSystemBase::GetGameBrowser()
 
 	UTpSystemBase_GetGameBrowser_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3559,12 +2789,8 @@ class UTpConnection* UTpSystemBase::GetConnection()
 
 	UTpSystemBase_GetConnection_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3580,12 +2806,8 @@ class UTpUserManager* UTpSystemBase::GetUserManager()
 
 	UTpSystemBase_GetUserManager_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3601,12 +2823,8 @@ class UTpPresenceManager* UTpSystemBase::GetPresenceManager()
 
 	UTpSystemBase_GetPresenceManager_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3622,12 +2840,8 @@ class UTpRankingService* UTpSystemBase::GetRankingService()
 
 	UTpSystemBase_GetRankingService_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3643,12 +2857,8 @@ class UTpPlayGroupManager* UTpSystemBase::GetPlayGroupManager()
 
 	UTpSystemBase_GetPlayGroupManager_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3664,12 +2874,8 @@ class UTpAssociationManager* UTpSystemBase::GetAssociationManager()
 
 	UTpSystemBase_GetAssociationManager_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3686,11 +2892,7 @@ void UTpSystemBase::ProcessTick(float DeltaSeconds)
 	UTpSystemBase_ProcessTick_Params params;
 	params.DeltaSeconds = DeltaSeconds;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3706,12 +2908,7 @@ void UTpSystemBase::NpEventLoopControl(int Op)
 	UTpSystemBase_NpEventLoopControl_Params params;
 	params.Op = Op;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3724,12 +2921,7 @@ void UTpSystemBase::End()
 
 	UTpSystemBase_End_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3745,12 +2937,7 @@ void UTpSystemBase::Initialize(const struct FTpInitializeParams& InParams)
 	UTpSystemBase_Initialize_Params params;
 	params.InParams = InParams;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3765,13 +2952,8 @@ class UTpSystemBase* UTpSystemBase::STATIC_Get()
 
 	UTpSystemBase_Get_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3785,11 +2967,7 @@ void UTpPresenceManager::OnPresenceUpdated()
 
 	UTpPresenceManager_OnPresenceUpdated_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3811,12 +2989,7 @@ void UTpPresenceManager::SetPresence(unsigned char LocalUserNum, int StatusId, i
 	params.ContextId = ContextId;
 	params.ContextValue = ContextValue;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3831,13 +3004,8 @@ struct FTpPresence UTpPresenceManager::GetLocalPresence()
 
 	UTpPresenceManager_GetLocalPresence_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3855,13 +3023,8 @@ struct FTpPresence UTpPresenceManager::GetPresence(const struct FUniqueNetId& Us
 	UTpPresenceManager_GetPresence_Params params;
 	params.User = User;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3878,11 +3041,7 @@ void UTpRankingService::OnFlushOnlineStatsComplete(bool bWasSuccessful)
 	UTpRankingService_OnFlushOnlineStatsComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3897,13 +3056,8 @@ bool UTpRankingService::FlushOnlineStats()
 
 	UTpRankingService_FlushOnlineStats_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3923,13 +3077,8 @@ bool UTpRankingService::WriteOnlineStats(const struct FUniqueNetId& Player, clas
 	params.Player = Player;
 	params.StatsWrite = StatsWrite;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -3946,13 +3095,8 @@ bool UTpRankingService::WriteOnlinePlayerScores(TArray<struct FOnlinePlayerScore
 
 	UTpRankingService_WriteOnlinePlayerScores_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (PlayerScores != nullptr)
 		*PlayerScores = params.PlayerScores;
 
@@ -3972,12 +3116,7 @@ void UTpRankingService::FreeStats(class UOnlineStatsRead* StatsRead)
 	UTpRankingService_FreeStats_Params params;
 	params.StatsRead = StatsRead;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -3993,11 +3132,7 @@ void UTpRankingService::OnReadOnlineStatsComplete(bool bWasSuccessful)
 	UTpRankingService_OnReadOnlineStatsComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4016,13 +3151,8 @@ bool UTpRankingService::ReadOnlineStatsByRankAroundPlayer(class UOnlineStatsRead
 	params.StatsRead = StatsRead;
 	params.NumRows = NumRows;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4044,13 +3174,8 @@ bool UTpRankingService::ReadOnlineStatsByRank(class UOnlineStatsRead* StatsRead,
 	params.StartIndex = StartIndex;
 	params.NumToRead = NumToRead;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4068,13 +3193,8 @@ bool UTpRankingService::ReadOnlineStatsForFriends(class UOnlineStatsRead* StatsR
 	UTpRankingService_ReadOnlineStatsForFriends_Params params;
 	params.StatsRead = StatsRead;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4093,13 +3213,8 @@ bool UTpRankingService::ReadOnlineStats(class UOnlineStatsRead* StatsRead, TArra
 	UTpRankingService_ReadOnlineStats_Params params;
 	params.StatsRead = StatsRead;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Players != nullptr)
 		*Players = params.Players;
 
@@ -4119,11 +3234,7 @@ void UTpRankingService::Initialize(class UTpSystemBase* InSystemBase)
 	UTpRankingService_Initialize_Params params;
 	params.InSystemBase = InSystemBase;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4142,13 +3253,8 @@ bool UTpUserManager::ShowSendMessageUI(const struct FUniqueNetId& Recipient, boo
 	params.Recipient = Recipient;
 	params.bIsFriendRequest = bIsFriendRequest;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4162,12 +3268,7 @@ void UTpUserManager::CancelShowGamerCardUI()
 
 	UTpUserManager_CancelShowGamerCardUI_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4183,11 +3284,7 @@ void UTpUserManager::OnShowGamerCardUI(bool bInOk)
 	UTpUserManager_OnShowGamerCardUI_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4206,13 +3303,8 @@ bool UTpUserManager::ShowGamerCardUI(unsigned char LocalUserNum, const struct FU
 	params.LocalUserNum = LocalUserNum;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4231,11 +3323,7 @@ void UTpUserManager::OnGetPlayerId(const struct FUniqueNetId& PlayerId, bool bIn
 	params.PlayerId = PlayerId;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4252,13 +3340,8 @@ bool UTpUserManager::LookupPlayerId(const struct FString& UserName)
 	UTpUserManager_LookupPlayerId_Params params;
 	params.UserName = UserName;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4276,13 +3359,8 @@ struct FString UTpUserManager::GetUsername(const struct FUniqueNetId& PlayerId)
 	UTpUserManager_GetUsername_Params params;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4300,13 +3378,8 @@ struct FUniqueNetId UTpUserManager::GetPlayerId(const struct FString& UserName)
 	UTpUserManager_GetPlayerId_Params params;
 	params.UserName = UserName;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4324,13 +3397,8 @@ struct FString UTpUserManager::GetLocalUsername(unsigned char LocalUserNum)
 	UTpUserManager_GetLocalUsername_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4346,13 +3414,8 @@ struct FUniqueNetId UTpUserManager::GetLocalPlayerId()
 
 	UTpUserManager_GetLocalPlayerId_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4369,11 +3432,7 @@ void UTpDebugger::OnDestroyGame(bool bOk)
 	UTpDebugger_OnDestroyGame_Params params;
 	params.bOk = bOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4389,11 +3448,7 @@ void UTpDebugger::DestroyGame(class UOnlineSubsystem* InSys)
 	UTpDebugger_DestroyGame_Params params;
 	params.InSys = InSys;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4409,11 +3464,7 @@ void UTpDebugger::OnCreateGame(bool bOk)
 	UTpDebugger_OnCreateGame_Params params;
 	params.bOk = bOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4433,11 +3484,7 @@ void UTpDebugger::CreateGame(class UOnlineSubsystem* InSys, const struct FString
 	params.InName = InName;
 	params.bInIsLan = bInIsLan;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4453,11 +3500,7 @@ void UTpDebugger::OnCreateAccount(bool bOk)
 	UTpDebugger_OnCreateAccount_Params params;
 	params.bOk = bOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4479,11 +3522,7 @@ void UTpDebugger::CreateAccount(class UOnlineSubsystem* InSys, const struct FStr
 	params.InPassword = InPassword;
 	params.InEmail = InEmail;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4499,11 +3538,7 @@ void UTpDebugger::OnLogout(bool bOk)
 	UTpDebugger_OnLogout_Params params;
 	params.bOk = bOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4519,11 +3554,7 @@ void UTpDebugger::Logout(class UOnlineSubsystem* InSys)
 	UTpDebugger_Logout_Params params;
 	params.InSys = InSys;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4541,11 +3572,7 @@ void UTpDebugger::OnLoginFailed(unsigned char LocalUserNum, TEnumAsByte<EOnlineS
 	params.LocalUserNum = LocalUserNum;
 	params.ErrorCode = ErrorCode;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4558,11 +3585,7 @@ void UTpDebugger::OnLoginChange()
 
 	UTpDebugger_OnLoginChange_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4582,11 +3605,7 @@ void UTpDebugger::Login(class UOnlineSubsystem* InSys, const struct FString& InN
 	params.InName = InName;
 	params.InPasswd = InPasswd;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4602,12 +3621,7 @@ void UTpDebugger::STATIC_Log(const struct FString& Str)
 	UTpDebugger_Log_Params params;
 	params.Str = Str;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4625,12 +3639,7 @@ void UTpDebugger::STATIC_StateFaulted(class UObject* InObject, const struct FStr
 	params.InObject = InObject;
 	params.InWhere = InWhere;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4646,12 +3655,7 @@ void UTpDebugger::STATIC_StateChanged(class UObject* InObject)
 	UTpDebugger_StateChanged_Params params;
 	params.InObject = InObject;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4667,12 +3671,7 @@ void UTpDebugger::STATIC_Register(class UObject* InObject)
 	UTpDebugger_Register_Params params;
 	params.InObject = InObject;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4688,12 +3687,7 @@ void UTpUoPlayer::SetActiveControllerIdNative(unsigned char LocalUserNum)
 	UTpUoPlayer_SetActiveControllerIdNative_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4710,13 +3704,8 @@ bool UTpUoPlayer::IsSignedIn(unsigned char LocalUserNum)
 	UTpUoPlayer_IsSignedIn_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4733,12 +3722,7 @@ void UTpUoPlayer::ProcessTick(float DeltaSeconds)
 	UTpUoPlayer_ProcessTick_Params params;
 	params.DeltaSeconds = DeltaSeconds;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4754,11 +3738,7 @@ void UTpUoPlayer::SetActiveControllerId(unsigned char LocalUserNum)
 	UTpUoPlayer_SetActiveControllerId_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4780,12 +3760,8 @@ TEnumAsByte<EOnlineEnumerationReadState> UTpUoPlayer::GetPlayersList(unsigned ch
 	params.Count = Count;
 	params.StartingAt = StartingAt;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Players != nullptr)
 		*Players = params.Players;
 
@@ -4807,11 +3783,7 @@ void UTpUoPlayer::ClearReadPlayersCompleteDelegate(unsigned char LocalUserNum, c
 	params.LocalUserNum = LocalUserNum;
 	params.ReadPlayersCompleteDelegate = ReadPlayersCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4829,11 +3801,7 @@ void UTpUoPlayer::SetReadPlayersCompleteDelegate(unsigned char LocalUserNum, con
 	params.LocalUserNum = LocalUserNum;
 	params.ReadPlayersCompleteDelegate = ReadPlayersCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4849,11 +3817,7 @@ void UTpUoPlayer::OnReadPlayersComplete_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnReadPlayersComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4869,11 +3833,7 @@ void UTpUoPlayer::OnReadPlayersComplete_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnReadPlayersComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4886,11 +3846,7 @@ void UTpUoPlayer::OnReadPlayersComplete_Invoke()
 
 	UTpUoPlayer_OnReadPlayersComplete_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4903,11 +3859,7 @@ void UTpUoPlayer::OnReadPlayersComplete()
 
 	UTpUoPlayer_OnReadPlayersComplete_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4928,12 +3880,8 @@ bool UTpUoPlayer::ReadPlayersList(unsigned char LocalUserNum, int Count, int Sta
 	params.Count = Count;
 	params.StartingAt = StartingAt;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4953,12 +3901,8 @@ bool UTpUoPlayer::DeleteMessage(unsigned char LocalUserNum, int MessageIndex)
 	params.LocalUserNum = LocalUserNum;
 	params.MessageIndex = MessageIndex;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -4977,11 +3921,7 @@ void UTpUoPlayer::OnNewMessage(const struct FUniqueNetId& PlayerId, const struct
 	params.PlayerId = PlayerId;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -4999,11 +3939,7 @@ void UTpUoPlayer::ClearFriendMessageReceivedDelegate(unsigned char LocalUserNum,
 	params.LocalUserNum = LocalUserNum;
 	params.MessageDelegate = MessageDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5021,11 +3957,7 @@ void UTpUoPlayer::AddFriendMessageReceivedDelegate(unsigned char LocalUserNum, c
 	params.LocalUserNum = LocalUserNum;
 	params.MessageDelegate = MessageDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5041,11 +3973,7 @@ void UTpUoPlayer::OnFriendMessageReceived_Remove(const struct FScriptDelegate& D
 	UTpUoPlayer_OnFriendMessageReceived_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5061,11 +3989,7 @@ void UTpUoPlayer::OnFriendMessageReceived_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnFriendMessageReceived_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5087,11 +4011,7 @@ void UTpUoPlayer::OnFriendMessageReceived_Invoke(unsigned char LocalUserNum, con
 	params.SendingNick = SendingNick;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5113,11 +4033,7 @@ void UTpUoPlayer::OnFriendMessageReceived(unsigned char LocalUserNum, const stru
 	params.SendingNick = SendingNick;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5134,12 +4050,8 @@ void UTpUoPlayer::GetFriendMessages(unsigned char LocalUserNum, TArray<struct FO
 	UTpUoPlayer_GetFriendMessages_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (FriendMessages != nullptr)
 		*FriendMessages = params.FriendMessages;
 }
@@ -5157,11 +4069,7 @@ void UTpUoPlayer::ClearJoinFriendGameCompleteDelegate(const struct FScriptDelega
 	UTpUoPlayer_ClearJoinFriendGameCompleteDelegate_Params params;
 	params.JoinFriendGameCompleteDelegate = JoinFriendGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5177,11 +4085,7 @@ void UTpUoPlayer::AddJoinFriendGameCompleteDelegate(const struct FScriptDelegate
 	UTpUoPlayer_AddJoinFriendGameCompleteDelegate_Params params;
 	params.JoinFriendGameCompleteDelegate = JoinFriendGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5197,11 +4101,7 @@ void UTpUoPlayer::OnJoinFriendGameComplete(bool bWasSuccessful)
 	UTpUoPlayer_OnJoinFriendGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5220,12 +4120,8 @@ bool UTpUoPlayer::JoinFriendGame(unsigned char LocalUserNum, const struct FUniqu
 	params.LocalUserNum = LocalUserNum;
 	params.Friend = Friend;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5244,11 +4140,7 @@ void UTpUoPlayer::ClearReceivedGameInviteDelegate(unsigned char LocalUserNum, co
 	params.LocalUserNum = LocalUserNum;
 	params.ReceivedGameInviteDelegate = ReceivedGameInviteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5266,11 +4158,7 @@ void UTpUoPlayer::AddReceivedGameInviteDelegate(unsigned char LocalUserNum, cons
 	params.LocalUserNum = LocalUserNum;
 	params.ReceivedGameInviteDelegate = ReceivedGameInviteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5288,11 +4176,7 @@ void UTpUoPlayer::OnReceivedGameInvite(unsigned char LocalUserNum, const struct
 	params.LocalUserNum = LocalUserNum;
 	params.InviterName = InviterName;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5313,12 +4197,8 @@ bool UTpUoPlayer::SendGameInviteToFriends(unsigned char LocalUserNum, TArray<str
 	params.Friends = Friends;
 	params.Text = Text;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5340,12 +4220,8 @@ bool UTpUoPlayer::SendGameInviteToFriend(unsigned char LocalUserNum, const struc
 	params.Friend = Friend;
 	params.Text = Text;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5364,11 +4240,7 @@ void UTpUoPlayer::ClearSendMessageByUsernameDelegate(unsigned char LocalUserNum,
 	params.LocalUserNum = LocalUserNum;
 	params.SendMessageDelegate = SendMessageDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5386,11 +4258,7 @@ void UTpUoPlayer::AddSendMessageByUsernameDelegate(unsigned char LocalUserNum, c
 	params.LocalUserNum = LocalUserNum;
 	params.SendMessageDelegate = SendMessageDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5406,11 +4274,7 @@ void UTpUoPlayer::OnSendMessageByUsername_Remove(const struct FScriptDelegate& D
 	UTpUoPlayer_OnSendMessageByUsername_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5426,11 +4290,7 @@ void UTpUoPlayer::OnSendMessageByUsername_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnSendMessageByUsername_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5446,11 +4306,7 @@ void UTpUoPlayer::OnSendMessageByUsername_Invoke(bool bSuccess)
 	UTpUoPlayer_OnSendMessageByUsername_Invoke_Params params;
 	params.bSuccess = bSuccess;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5466,11 +4322,7 @@ void UTpUoPlayer::OnSendMessageByUsername(bool bSuccess)
 	UTpUoPlayer_OnSendMessageByUsername_Params params;
 	params.bSuccess = bSuccess;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5486,11 +4338,7 @@ void UTpUoPlayer::OnSendMessageByUsernameDone(bool bInOk)
 	UTpUoPlayer_OnSendMessageByUsernameDone_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5508,11 +4356,7 @@ void UTpUoPlayer::SendMessageByUsernameStepTwo(const struct FUniqueNetId& Player
 	params.PlayerId = PlayerId;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5532,11 +4376,7 @@ void UTpUoPlayer::SendMessageByUsername(unsigned char LocalUserNum, const struct
 	params.UserName = UserName;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5557,12 +4397,8 @@ bool UTpUoPlayer::SendMessageToFriend(unsigned char LocalUserNum, const struct F
 	params.Friend = Friend;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5581,11 +4417,7 @@ void UTpUoPlayer::OnFriendRequestDelegate(const struct FUniqueNetId& RequestingP
 	params.RequestingPlayer = RequestingPlayer;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5603,11 +4435,7 @@ void UTpUoPlayer::ClearFriendInviteReceivedDelegate(unsigned char LocalUserNum,
 	params.LocalUserNum = LocalUserNum;
 	params.InviteDelegate = InviteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5625,11 +4453,7 @@ void UTpUoPlayer::AddFriendInviteReceivedDelegate(unsigned char LocalUserNum, co
 	params.LocalUserNum = LocalUserNum;
 	params.InviteDelegate = InviteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5645,11 +4469,7 @@ void UTpUoPlayer::OnFriendInviteReceived_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnFriendInviteReceived_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5665,11 +4485,7 @@ void UTpUoPlayer::OnFriendInviteReceived_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnFriendInviteReceived_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5691,11 +4507,7 @@ void UTpUoPlayer::OnFriendInviteReceived_Invoke(unsigned char LocalUserNum, cons
 	params.RequestingNick = RequestingNick;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5717,11 +4529,7 @@ void UTpUoPlayer::OnFriendInviteReceived(unsigned char LocalUserNum, const struc
 	params.RequestingNick = RequestingNick;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5740,12 +4548,8 @@ bool UTpUoPlayer::RemoveFriend(unsigned char LocalUserNum, const struct FUniqueN
 	params.LocalUserNum = LocalUserNum;
 	params.FormerFriend = FormerFriend;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5765,12 +4569,8 @@ bool UTpUoPlayer::DenyFriendInvite(unsigned char LocalUserNum, const struct FUni
 	params.LocalUserNum = LocalUserNum;
 	params.RequestingPlayer = RequestingPlayer;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5790,12 +4590,8 @@ bool UTpUoPlayer::AcceptFriendInvite(unsigned char LocalUserNum, const struct FU
 	params.LocalUserNum = LocalUserNum;
 	params.RequestingPlayer = RequestingPlayer;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -5814,11 +4610,7 @@ void UTpUoPlayer::ClearAddFriendByNameCompleteDelegate(unsigned char LocalUserNu
 	params.LocalUserNum = LocalUserNum;
 	params.FriendDelegate = FriendDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5836,11 +4628,7 @@ void UTpUoPlayer::AddAddFriendByNameCompleteDelegate(unsigned char LocalUserNum,
 	params.LocalUserNum = LocalUserNum;
 	params.FriendDelegate = FriendDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5856,11 +4644,7 @@ void UTpUoPlayer::OnAddFriendByNameComplete_Remove(const struct FScriptDelegate&
 	UTpUoPlayer_OnAddFriendByNameComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5876,11 +4660,7 @@ void UTpUoPlayer::OnAddFriendByNameComplete_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnAddFriendByNameComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5896,11 +4676,7 @@ void UTpUoPlayer::OnAddFriendByNameComplete_Invoke(bool bWasSuccessful)
 	UTpUoPlayer_OnAddFriendByNameComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5916,11 +4692,7 @@ void UTpUoPlayer::OnAddFriendByNameComplete(bool bWasSuccessful)
 	UTpUoPlayer_OnAddFriendByNameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5936,11 +4708,7 @@ void UTpUoPlayer::OnAddFriend(bool bWasSuccessful)
 	UTpUoPlayer_OnAddFriend_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5958,11 +4726,7 @@ void UTpUoPlayer::OnLookupPlayerIdForAddFriend(const struct FUniqueNetId& UserId
 	params.UserId = UserId;
 	params.bSuccess = bSuccess;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -5983,12 +4747,8 @@ bool UTpUoPlayer::AddFriendByName(unsigned char LocalUserNum, const struct FStri
 	params.FriendName = FriendName;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6010,12 +4770,8 @@ bool UTpUoPlayer::AddFriend(unsigned char LocalUserNum, const struct FUniqueNetI
 	params.NewFriend = NewFriend;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6032,12 +4788,7 @@ void UTpUoPlayer::SetKeyboardInputResults(const struct FString& Value)
 	UTpUoPlayer_SetKeyboardInputResults_Params params;
 	params.Value = Value;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6053,13 +4804,8 @@ struct FString UTpUoPlayer::GetKeyboardInputResults(unsigned char* bWasCanceled)
 
 	UTpUoPlayer_GetKeyboardInputResults_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (bWasCanceled != nullptr)
 		*bWasCanceled = params.bWasCanceled;
 
@@ -6079,11 +4825,7 @@ void UTpUoPlayer::ClearKeyboardInputDoneDelegate(const struct FScriptDelegate& I
 	UTpUoPlayer_ClearKeyboardInputDoneDelegate_Params params;
 	params.InputDelegate = InputDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6099,11 +4841,7 @@ void UTpUoPlayer::AddKeyboardInputDoneDelegate(const struct FScriptDelegate& Inp
 	UTpUoPlayer_AddKeyboardInputDoneDelegate_Params params;
 	params.InputDelegate = InputDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6119,11 +4857,7 @@ void UTpUoPlayer::OnKeyboardInputComplete_Remove(const struct FScriptDelegate& D
 	UTpUoPlayer_OnKeyboardInputComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6139,11 +4873,7 @@ void UTpUoPlayer::OnKeyboardInputComplete_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnKeyboardInputComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6159,11 +4889,7 @@ void UTpUoPlayer::OnKeyboardInputComplete_Invoke(bool bWasSuccessful)
 	UTpUoPlayer_OnKeyboardInputComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6179,11 +4905,7 @@ void UTpUoPlayer::OnKeyboardInputComplete(bool bWasSuccessful)
 	UTpUoPlayer_OnKeyboardInputComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6212,13 +4934,8 @@ bool UTpUoPlayer::ShowKeyboardUI(unsigned char LocalUserNum, const struct FStrin
 	params.DefaultText = DefaultText;
 	params.MaxResultLength = MaxResultLength;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6239,12 +4956,8 @@ void UTpUoPlayer::SetOnlineStatus(unsigned char LocalUserNum, int StatusId, TArr
 	params.LocalUserNum = LocalUserNum;
 	params.StatusId = StatusId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (LocalizedStringSettings != nullptr)
 		*LocalizedStringSettings = params.LocalizedStringSettings;
 	if (Properties != nullptr)
@@ -6270,12 +4983,8 @@ TEnumAsByte<EOnlineEnumerationReadState> UTpUoPlayer::GetFriendsList(unsigned ch
 	params.Count = Count;
 	params.StartingAt = StartingAt;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Friends != nullptr)
 		*Friends = params.Friends;
 
@@ -6297,11 +5006,7 @@ void UTpUoPlayer::ClearReadFriendsCompleteDelegate(unsigned char LocalUserNum, c
 	params.LocalUserNum = LocalUserNum;
 	params.ReadFriendsCompleteDelegate = ReadFriendsCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6319,11 +5024,7 @@ void UTpUoPlayer::AddReadFriendsCompleteDelegate(unsigned char LocalUserNum, con
 	params.LocalUserNum = LocalUserNum;
 	params.ReadFriendsCompleteDelegate = ReadFriendsCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6339,11 +5040,7 @@ void UTpUoPlayer::OnFriendsListLoaded(bool bInOk)
 	UTpUoPlayer_OnFriendsListLoaded_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6359,11 +5056,7 @@ void UTpUoPlayer::OnReadFriendsComplete_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnReadFriendsComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6379,11 +5072,7 @@ void UTpUoPlayer::OnReadFriendsComplete_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnReadFriendsComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6399,11 +5088,7 @@ void UTpUoPlayer::OnReadFriendsComplete_Invoke(bool bWasSuccessful)
 	UTpUoPlayer_OnReadFriendsComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6419,11 +5104,7 @@ void UTpUoPlayer::OnReadFriendsComplete(bool bWasSuccessful)
 	UTpUoPlayer_OnReadFriendsComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6444,12 +5125,8 @@ bool UTpUoPlayer::ReadFriendsList(unsigned char LocalUserNum, int Count, int Sta
 	params.Count = Count;
 	params.StartingAt = StartingAt;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6468,11 +5145,7 @@ void UTpUoPlayer::ClearWriteProfileSettingsCompleteDelegate(unsigned char LocalU
 	params.LocalUserNum = LocalUserNum;
 	params.WriteProfileSettingsCompleteDelegate = WriteProfileSettingsCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6490,11 +5163,7 @@ void UTpUoPlayer::AddWriteProfileSettingsCompleteDelegate(unsigned char LocalUse
 	params.LocalUserNum = LocalUserNum;
 	params.WriteProfileSettingsCompleteDelegate = WriteProfileSettingsCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6510,11 +5179,7 @@ void UTpUoPlayer::SaveSystemWriteProfileComplete(TEnumAsByte<ETsResult> Result)
 	UTpUoPlayer_SaveSystemWriteProfileComplete_Params params;
 	params.Result = Result;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6533,12 +5198,8 @@ bool UTpUoPlayer::WriteProfileSettings(unsigned char LocalUserNum, class UOnline
 	params.LocalUserNum = LocalUserNum;
 	params.ProfileSettings = ProfileSettings;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6555,11 +5216,7 @@ void UTpUoPlayer::OnWriteProfileSettingsComplete_Remove(const struct FScriptDele
 	UTpUoPlayer_OnWriteProfileSettingsComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6575,11 +5232,7 @@ void UTpUoPlayer::OnWriteProfileSettingsComplete_Add(const struct FScriptDelegat
 	UTpUoPlayer_OnWriteProfileSettingsComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6595,11 +5248,7 @@ void UTpUoPlayer::OnWriteProfileSettingsComplete_Invoke(bool bWasSuccessful)
 	UTpUoPlayer_OnWriteProfileSettingsComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6615,11 +5264,7 @@ void UTpUoPlayer::OnWriteProfileSettingsComplete(bool bWasSuccessful)
 	UTpUoPlayer_OnWriteProfileSettingsComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6636,12 +5281,8 @@ class UOnlineProfileSettings* UTpUoPlayer::GetProfileSettings(unsigned char Loca
 	UTpUoPlayer_GetProfileSettings_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6660,11 +5301,7 @@ void UTpUoPlayer::ClearReadProfileSettingsCompleteDelegate(unsigned char LocalUs
 	params.LocalUserNum = LocalUserNum;
 	params.ReadProfileSettingsCompleteDelegate = ReadProfileSettingsCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6682,11 +5319,7 @@ void UTpUoPlayer::AddReadProfileSettingsCompleteDelegate(unsigned char LocalUser
 	params.LocalUserNum = LocalUserNum;
 	params.ReadProfileSettingsCompleteDelegate = ReadProfileSettingsCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6702,11 +5335,7 @@ void UTpUoPlayer::SaveSystemReadProfileComplete(TEnumAsByte<ETsResult> Result)
 	UTpUoPlayer_SaveSystemReadProfileComplete_Params params;
 	params.Result = Result;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6725,12 +5354,8 @@ bool UTpUoPlayer::ReadProfileSettings(unsigned char LocalUserNum, class UOnlineP
 	params.LocalUserNum = LocalUserNum;
 	params.ProfileSettings = ProfileSettings;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -6747,11 +5372,7 @@ void UTpUoPlayer::OnReadProfileSettingsComplete_Remove(const struct FScriptDeleg
 	UTpUoPlayer_OnReadProfileSettingsComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6767,11 +5388,7 @@ void UTpUoPlayer::OnReadProfileSettingsComplete_Add(const struct FScriptDelegate
 	UTpUoPlayer_OnReadProfileSettingsComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6787,11 +5404,7 @@ void UTpUoPlayer::OnReadProfileSettingsComplete_Invoke(bool bWasSuccessful)
 	UTpUoPlayer_OnReadProfileSettingsComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6807,11 +5420,7 @@ void UTpUoPlayer::OnReadProfileSettingsComplete(bool bWasSuccessful)
 	UTpUoPlayer_OnReadProfileSettingsComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6829,11 +5438,7 @@ void UTpUoPlayer::ClearFriendsChangeDelegate(unsigned char LocalUserNum, const s
 	params.LocalUserNum = LocalUserNum;
 	params.FriendsDelegate = FriendsDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6851,11 +5456,7 @@ void UTpUoPlayer::AddFriendsChangeDelegate(unsigned char LocalUserNum, const str
 	params.LocalUserNum = LocalUserNum;
 	params.FriendsDelegate = FriendsDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6868,11 +5469,7 @@ void UTpUoPlayer::OnFriendsChangeDelegate()
 
 	UTpUoPlayer_OnFriendsChangeDelegate_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6885,11 +5482,7 @@ void UTpUoPlayer::OnPresenceChangeDelegate()
 
 	UTpUoPlayer_OnPresenceChangeDelegate_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6905,11 +5498,7 @@ void UTpUoPlayer::ClearMutingChangeDelegate(const struct FScriptDelegate& Muting
 	UTpUoPlayer_ClearMutingChangeDelegate_Params params;
 	params.MutingDelegate = MutingDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6925,11 +5514,7 @@ void UTpUoPlayer::AddMutingChangeDelegate(const struct FScriptDelegate& MutingDe
 	UTpUoPlayer_AddMutingChangeDelegate_Params params;
 	params.MutingDelegate = MutingDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6945,11 +5530,7 @@ void UTpUoPlayer::ClearLoginCancelledDelegate(const struct FScriptDelegate& Canc
 	UTpUoPlayer_ClearLoginCancelledDelegate_Params params;
 	params.CancelledDelegate = CancelledDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6965,11 +5546,7 @@ void UTpUoPlayer::AddLoginCancelledDelegate(const struct FScriptDelegate& Cancel
 	UTpUoPlayer_AddLoginCancelledDelegate_Params params;
 	params.CancelledDelegate = CancelledDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -6987,11 +5564,7 @@ void UTpUoPlayer::ClearLoginChangeDelegate(const struct FScriptDelegate& LoginDe
 	params.LoginDelegate = LoginDelegate;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7009,11 +5582,7 @@ void UTpUoPlayer::AddLoginChangeDelegate(const struct FScriptDelegate& LoginDele
 	params.LoginDelegate = LoginDelegate;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7030,13 +5599,8 @@ bool UTpUoPlayer::ShowFriendsUI(unsigned char LocalUserNum)
 	UTpUoPlayer_ShowFriendsUI_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7056,12 +5620,8 @@ bool UTpUoPlayer::IsMuted(unsigned char LocalUserNum, const struct FUniqueNetId&
 	params.LocalUserNum = LocalUserNum;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7080,12 +5640,8 @@ bool UTpUoPlayer::AreAnyFriends(unsigned char LocalUserNum, TArray<struct FFrien
 	UTpUoPlayer_AreAnyFriends_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Query != nullptr)
 		*Query = params.Query;
 
@@ -7108,12 +5664,8 @@ bool UTpUoPlayer::IsFriend(unsigned char LocalUserNum, const struct FUniqueNetId
 	params.LocalUserNum = LocalUserNum;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7131,12 +5683,8 @@ TEnumAsByte<EFeaturePrivilegeLevel> UTpUoPlayer::CanShowPresenceInformation(unsi
 	UTpUoPlayer_CanShowPresenceInformation_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7154,12 +5702,8 @@ TEnumAsByte<EFeaturePrivilegeLevel> UTpUoPlayer::CanViewPlayerProfiles(unsigned
 	UTpUoPlayer_CanViewPlayerProfiles_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7177,12 +5721,8 @@ TEnumAsByte<EFeaturePrivilegeLevel> UTpUoPlayer::CanPurchaseContent(unsigned cha
 	UTpUoPlayer_CanPurchaseContent_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7200,12 +5740,8 @@ TEnumAsByte<EFeaturePrivilegeLevel> UTpUoPlayer::CanDownloadUserContent(unsigned
 	UTpUoPlayer_CanDownloadUserContent_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7223,12 +5759,8 @@ TEnumAsByte<EFeaturePrivilegeLevel> UTpUoPlayer::CanCommunicate(unsigned char Lo
 	UTpUoPlayer_CanCommunicate_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7246,12 +5778,8 @@ TEnumAsByte<EFeaturePrivilegeLevel> UTpUoPlayer::CanPlayOnline(unsigned char Loc
 	UTpUoPlayer_CanPlayOnline_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7269,12 +5797,8 @@ struct FString UTpUoPlayer::GetPlayerNickname(unsigned char LocalUserNum)
 	UTpUoPlayer_GetPlayerNickname_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7293,12 +5817,8 @@ bool UTpUoPlayer::GetUniquePlayerId(unsigned char LocalUserNum, struct FUniqueNe
 	UTpUoPlayer_GetUniquePlayerId_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (PlayerId != nullptr)
 		*PlayerId = params.PlayerId;
 
@@ -7319,12 +5839,8 @@ TEnumAsByte<ELoginStatus> UTpUoPlayer::GetLoginStatus(unsigned char LocalUserNum
 	UTpUoPlayer_GetLoginStatus_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7343,11 +5859,7 @@ void UTpUoPlayer::ClearLogoutCompletedDelegate(unsigned char LocalUserNum, const
 	params.LocalUserNum = LocalUserNum;
 	params.LogoutDelegate = LogoutDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7365,11 +5877,7 @@ void UTpUoPlayer::AddLogoutCompletedDelegate(unsigned char LocalUserNum, const s
 	params.LocalUserNum = LocalUserNum;
 	params.LogoutDelegate = LogoutDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7385,11 +5893,7 @@ void UTpUoPlayer::OnLogoutCompleted_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnLogoutCompleted_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7405,11 +5909,7 @@ void UTpUoPlayer::OnLogoutCompleted_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnLogoutCompleted_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7425,11 +5925,7 @@ void UTpUoPlayer::OnLogoutCompleted_Invoke(bool bWasSuccessful)
 	UTpUoPlayer_OnLogoutCompleted_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7445,11 +5941,7 @@ void UTpUoPlayer::OnLogoutCompleted(bool bWasSuccessful)
 	UTpUoPlayer_OnLogoutCompleted_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7466,12 +5958,8 @@ bool UTpUoPlayer::Logout(unsigned char LocalUserNum)
 	UTpUoPlayer_Logout_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7490,11 +5978,7 @@ void UTpUoPlayer::ClearLoginFailedDelegate(unsigned char LocalUserNum, const str
 	params.LocalUserNum = LocalUserNum;
 	params.LoginDelegate = LoginDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7512,11 +5996,7 @@ void UTpUoPlayer::AddLoginFailedDelegate(unsigned char LocalUserNum, const struc
 	params.LocalUserNum = LocalUserNum;
 	params.LoginDelegate = LoginDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7532,11 +6012,7 @@ void UTpUoPlayer::OnLoginFailed_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnLoginFailed_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7552,11 +6028,7 @@ void UTpUoPlayer::OnLoginFailed_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnLoginFailed_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7574,11 +6046,7 @@ void UTpUoPlayer::OnLoginFailed_Invoke(unsigned char LocalUserNum, TEnumAsByte<E
 	params.LocalUserNum = LocalUserNum;
 	params.ErrorCode = ErrorCode;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7596,11 +6064,7 @@ void UTpUoPlayer::OnLoginFailed(unsigned char LocalUserNum, TEnumAsByte<EOnlineS
 	params.LocalUserNum = LocalUserNum;
 	params.ErrorCode = ErrorCode;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7615,12 +6079,8 @@ bool UTpUoPlayer::AutoLogin()
 
 	UTpUoPlayer_AutoLogin_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7644,12 +6104,8 @@ bool UTpUoPlayer::Login(unsigned char LocalUserNum, const struct FString& LoginN
 	params.Password = Password;
 	params.bWantsLocalOnly = bWantsLocalOnly;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7667,13 +6123,8 @@ bool UTpUoPlayer::ShowLoginUI(bool bShowOnlineOnly)
 	UTpUoPlayer_ShowLoginUI_Params params;
 	params.bShowOnlineOnly = bShowOnlineOnly;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -7690,11 +6141,7 @@ void UTpUoPlayer::OnFriendsChange_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnFriendsChange_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7710,11 +6157,7 @@ void UTpUoPlayer::OnFriendsChange_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnFriendsChange_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7727,11 +6170,7 @@ void UTpUoPlayer::OnFriendsChange_Invoke()
 
 	UTpUoPlayer_OnFriendsChange_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7744,11 +6183,7 @@ void UTpUoPlayer::OnFriendsChange()
 
 	UTpUoPlayer_OnFriendsChange_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7764,11 +6199,7 @@ void UTpUoPlayer::OnMutingChange_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnMutingChange_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7784,11 +6215,7 @@ void UTpUoPlayer::OnMutingChange_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnMutingChange_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7801,11 +6228,7 @@ void UTpUoPlayer::OnMutingChange_Invoke()
 
 	UTpUoPlayer_OnMutingChange_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7818,11 +6241,7 @@ void UTpUoPlayer::OnMutingChange()
 
 	UTpUoPlayer_OnMutingChange_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7838,11 +6257,7 @@ void UTpUoPlayer::OnLoginCancelled_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnLoginCancelled_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7858,11 +6273,7 @@ void UTpUoPlayer::OnLoginCancelled_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnLoginCancelled_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7875,11 +6286,7 @@ void UTpUoPlayer::OnLoginCancelled_Invoke()
 
 	UTpUoPlayer_OnLoginCancelled_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7892,11 +6299,7 @@ void UTpUoPlayer::OnLoginCancelled()
 
 	UTpUoPlayer_OnLoginCancelled_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7912,11 +6315,7 @@ void UTpUoPlayer::OnLoginChange_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnLoginChange_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7932,11 +6331,7 @@ void UTpUoPlayer::OnLoginChange_Add(const struct FScriptDelegate& D)
 	UTpUoPlayer_OnLoginChange_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7949,11 +6344,7 @@ void UTpUoPlayer::OnLoginChange_Invoke()
 
 	UTpUoPlayer_OnLoginChange_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7966,11 +6357,7 @@ void UTpUoPlayer::OnLoginChange()
 
 	UTpUoPlayer_OnLoginChange_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -7983,12 +6370,7 @@ void UTpUoPlayer::InitializeNative()
 
 	UTpUoPlayer_InitializeNative_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8004,11 +6386,7 @@ void UTpUoPlayer::Initialize(class UTpSystemBase* InSystemBase)
 	UTpUoPlayer_Initialize_Params params;
 	params.InSystemBase = InSystemBase;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8027,12 +6405,8 @@ bool UTpUoPlayerEx::ShowSendMessageUI(const struct FUniqueNetId& PlayerId, bool
 	params.PlayerId = PlayerId;
 	params.bIsFriendRequest = bIsFriendRequest;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8050,12 +6424,8 @@ bool UTpUoPlayerEx::ShowPlayersUI(unsigned char LocalUserNum)
 	UTpUoPlayerEx_ShowPlayersUI_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8075,12 +6445,8 @@ bool UTpUoPlayerEx::ShowFriendsInviteUI(unsigned char LocalUserNum, const struct
 	params.LocalUserNum = LocalUserNum;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8099,11 +6465,7 @@ void UTpUoPlayerEx::ClearProfileDataChangedDelegate(unsigned char LocalUserNum,
 	params.LocalUserNum = LocalUserNum;
 	params.ProfileDataChangedDelegate = ProfileDataChangedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8121,11 +6483,7 @@ void UTpUoPlayerEx::AddProfileDataChangedDelegate(unsigned char LocalUserNum, co
 	params.LocalUserNum = LocalUserNum;
 	params.ProfileDataChangedDelegate = ProfileDataChangedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8138,11 +6496,7 @@ void UTpUoPlayerEx::OnProfileDataChanged()
 
 	UTpUoPlayerEx_OnProfileDataChanged_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8161,12 +6515,8 @@ bool UTpUoPlayerEx::UnlockGamerPicture(unsigned char LocalUserNum, int PictureId
 	params.LocalUserNum = LocalUserNum;
 	params.PictureId = PictureId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8183,11 +6533,7 @@ void UTpUoPlayerEx::OnUnlockAchievementComplete(bool bWasSuccessful)
 	UTpUoPlayerEx_OnUnlockAchievementComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8205,11 +6551,7 @@ void UTpUoPlayerEx::ClearUnlockAchievementCompleteDelegate(unsigned char LocalUs
 	params.LocalUserNum = LocalUserNum;
 	params.UnlockAchievementCompleteDelegate = UnlockAchievementCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8227,11 +6569,7 @@ void UTpUoPlayerEx::AddUnlockAchievementCompleteDelegate(unsigned char LocalUser
 	params.LocalUserNum = LocalUserNum;
 	params.UnlockAchievementCompleteDelegate = UnlockAchievementCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8250,12 +6588,8 @@ bool UTpUoPlayerEx::UnlockAchievement(unsigned char LocalUserNum, int Achievemen
 	params.LocalUserNum = LocalUserNum;
 	params.AchievementId = AchievementId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8273,12 +6607,8 @@ bool UTpUoPlayerEx::IsDeviceValid(int DeviceID)
 	UTpUoPlayerEx_IsDeviceValid_Params params;
 	params.DeviceID = DeviceID;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8295,11 +6625,7 @@ void UTpUoPlayerEx::OnDeviceSelectionComplete(bool bWasSuccessful)
 	UTpUoPlayerEx_OnDeviceSelectionComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8317,12 +6643,8 @@ int UTpUoPlayerEx::GetDeviceSelectionResults(unsigned char LocalUserNum, struct
 	UTpUoPlayerEx_GetDeviceSelectionResults_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (DeviceName != nullptr)
 		*DeviceName = params.DeviceName;
 
@@ -8344,11 +6666,7 @@ void UTpUoPlayerEx::ClearDeviceSelectionDoneDelegate(unsigned char LocalUserNum,
 	params.LocalUserNum = LocalUserNum;
 	params.DeviceDelegate = DeviceDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8366,11 +6684,7 @@ void UTpUoPlayerEx::AddDeviceSelectionDoneDelegate(unsigned char LocalUserNum, c
 	params.LocalUserNum = LocalUserNum;
 	params.DeviceDelegate = DeviceDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8391,12 +6705,8 @@ bool UTpUoPlayerEx::ShowDeviceSelectionUI(unsigned char LocalUserNum, int SizeNe
 	params.SizeNeeded = SizeNeeded;
 	params.bForceShowUI = bForceShowUI;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8414,12 +6724,8 @@ bool UTpUoPlayerEx::ShowMembershipMarketplaceUI(unsigned char LocalUserNum)
 	UTpUoPlayerEx_ShowMembershipMarketplaceUI_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8437,13 +6743,8 @@ bool UTpUoPlayerEx::ShowContentMarketplaceUI(unsigned char LocalUserNum)
 	UTpUoPlayerEx_ShowContentMarketplaceUI_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8463,12 +6764,8 @@ bool UTpUoPlayerEx::ShowInviteUI(unsigned char LocalUserNum, const struct FStrin
 	params.LocalUserNum = LocalUserNum;
 	params.InviteText = InviteText;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8486,12 +6783,8 @@ bool UTpUoPlayerEx::ShowAchievementsUI(unsigned char LocalUserNum)
 	UTpUoPlayerEx_ShowAchievementsUI_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8509,12 +6802,8 @@ bool UTpUoPlayerEx::ShowMessagesUI(unsigned char LocalUserNum)
 	UTpUoPlayerEx_ShowMessagesUI_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8528,11 +6817,7 @@ void UTpUoPlayerEx::CancelShowGamerCardUI()
 
 	UTpUoPlayerEx_CancelShowGamerCardUI_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8548,11 +6833,7 @@ void UTpUoPlayerEx::OnShowGamerCardUI(bool bWasSuccessful)
 	UTpUoPlayerEx_OnShowGamerCardUI_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8568,11 +6849,7 @@ void UTpUoPlayerEx::ClearShowGamerCardResultDelegate(const struct FScriptDelegat
 	UTpUoPlayerEx_ClearShowGamerCardResultDelegate_Params params;
 	params.GamerCardDelegate = GamerCardDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8588,11 +6865,7 @@ void UTpUoPlayerEx::AddShowGamerCardResultDelegate(const struct FScriptDelegate&
 	UTpUoPlayerEx_AddShowGamerCardResultDelegate_Params params;
 	params.GamerCardDelegate = GamerCardDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8608,11 +6881,7 @@ void UTpUoPlayerEx::OnShowGamerCardResult_Remove(const struct FScriptDelegate& D
 	UTpUoPlayerEx_OnShowGamerCardResult_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8628,11 +6897,7 @@ void UTpUoPlayerEx::OnShowGamerCardResult_Add(const struct FScriptDelegate& D)
 	UTpUoPlayerEx_OnShowGamerCardResult_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8648,11 +6913,7 @@ void UTpUoPlayerEx::OnShowGamerCardResult_Invoke(bool bWasSuccessful)
 	UTpUoPlayerEx_OnShowGamerCardResult_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8668,11 +6929,7 @@ void UTpUoPlayerEx::OnShowGamerCardResult(bool bWasSuccessful)
 	UTpUoPlayerEx_OnShowGamerCardResult_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8691,12 +6948,8 @@ bool UTpUoPlayerEx::ShowGamerCardUI(unsigned char LocalUserNum, const struct FUn
 	params.LocalUserNum = LocalUserNum;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8716,12 +6969,8 @@ bool UTpUoPlayerEx::ShowFeedbackUI(unsigned char LocalUserNum, const struct FUni
 	params.LocalUserNum = LocalUserNum;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8738,11 +6987,7 @@ void UTpUoPlayerEx::Initialize(class UTpSystemBase* InSystemBase)
 	UTpUoPlayerEx_Initialize_Params params;
 	params.InSystemBase = InSystemBase;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8758,12 +7003,7 @@ void UTpUoSystem::ProcessTick(float DeltaSeconds)
 	UTpUoSystem_ProcessTick_Params params;
 	params.DeltaSeconds = DeltaSeconds;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8779,11 +7019,7 @@ void UTpUoSystem::ClearStorageDeviceChangeDelegate(const struct FScriptDelegate&
 	UTpUoSystem_ClearStorageDeviceChangeDelegate_Params params;
 	params.StorageDeviceChangeDelegate = StorageDeviceChangeDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8799,11 +7035,7 @@ void UTpUoSystem::AddStorageDeviceChangeDelegate(const struct FScriptDelegate& S
 	UTpUoSystem_AddStorageDeviceChangeDelegate_Params params;
 	params.StorageDeviceChangeDelegate = StorageDeviceChangeDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8819,11 +7051,7 @@ void UTpUoSystem::OnStorageDeviceChange_Remove(const struct FScriptDelegate& D)
 	UTpUoSystem_OnStorageDeviceChange_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8839,11 +7067,7 @@ void UTpUoSystem::OnStorageDeviceChange_Add(const struct FScriptDelegate& D)
 	UTpUoSystem_OnStorageDeviceChange_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8856,11 +7080,7 @@ void UTpUoSystem::OnStorageDeviceChange_Invoke()
 
 	UTpUoSystem_OnStorageDeviceChange_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8873,11 +7093,7 @@ void UTpUoSystem::OnStorageDeviceChange()
 
 	UTpUoSystem_OnStorageDeviceChange_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8892,12 +7108,8 @@ TEnumAsByte<ENATType> UTpUoSystem::GetNATType()
 
 	UTpUoSystem_GetNATType_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -8914,11 +7126,7 @@ void UTpUoSystem::ClearConnectionStatusChangeDelegate(const struct FScriptDelega
 	UTpUoSystem_ClearConnectionStatusChangeDelegate_Params params;
 	params.ConnectionStatusDelegate = ConnectionStatusDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8934,11 +7142,7 @@ void UTpUoSystem::AddConnectionStatusChangeDelegate(const struct FScriptDelegate
 	UTpUoSystem_AddConnectionStatusChangeDelegate_Params params;
 	params.ConnectionStatusDelegate = ConnectionStatusDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8954,11 +7158,7 @@ void UTpUoSystem::OnConnectionChange(bool bConnected)
 	UTpUoSystem_OnConnectionChange_Params params;
 	params.bConnected = bConnected;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8974,11 +7174,7 @@ void UTpUoSystem::OnConnectionStatusChange_Remove(const struct FScriptDelegate&
 	UTpUoSystem_OnConnectionStatusChange_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -8994,11 +7190,7 @@ void UTpUoSystem::OnConnectionStatusChange_Add(const struct FScriptDelegate& D)
 	UTpUoSystem_OnConnectionStatusChange_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9014,11 +7206,7 @@ void UTpUoSystem::OnConnectionStatusChange_Invoke(TEnumAsByte<EOnlineServerConne
 	UTpUoSystem_OnConnectionStatusChange_Invoke_Params params;
 	params.ConnectionStatus = ConnectionStatus;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9034,11 +7222,7 @@ void UTpUoSystem::OnConnectionStatusChange(TEnumAsByte<EOnlineServerConnectionSt
 	UTpUoSystem_OnConnectionStatusChange_Params params;
 	params.ConnectionStatus = ConnectionStatus;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9055,12 +7239,8 @@ bool UTpUoSystem::IsControllerConnected(int ControllerId)
 	UTpUoSystem_IsControllerConnected_Params params;
 	params.ControllerId = ControllerId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -9077,11 +7257,7 @@ void UTpUoSystem::ClearControllerChangeDelegate(const struct FScriptDelegate& Co
 	UTpUoSystem_ClearControllerChangeDelegate_Params params;
 	params.ControllerChangeDelegate = ControllerChangeDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9097,11 +7273,7 @@ void UTpUoSystem::AddControllerChangeDelegate(const struct FScriptDelegate& Cont
 	UTpUoSystem_AddControllerChangeDelegate_Params params;
 	params.ControllerChangeDelegate = ControllerChangeDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9117,11 +7289,7 @@ void UTpUoSystem::OnControllerChange_Remove(const struct FScriptDelegate& D)
 	UTpUoSystem_OnControllerChange_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9137,11 +7305,7 @@ void UTpUoSystem::OnControllerChange_Add(const struct FScriptDelegate& D)
 	UTpUoSystem_OnControllerChange_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9159,11 +7323,7 @@ void UTpUoSystem::OnControllerChange_Invoke(int ControllerId, bool bIsConnected)
 	params.ControllerId = ControllerId;
 	params.bIsConnected = bIsConnected;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9181,11 +7341,7 @@ void UTpUoSystem::OnControllerChange(int ControllerId, bool bIsConnected)
 	params.ControllerId = ControllerId;
 	params.bIsConnected = bIsConnected;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9201,11 +7357,7 @@ void UTpUoSystem::SetNetworkNotificationPosition(TEnumAsByte<ENetworkNotificatio
 	UTpUoSystem_SetNetworkNotificationPosition_Params params;
 	params.NewPos = NewPos;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9220,12 +7372,8 @@ TEnumAsByte<ENetworkNotificationPosition> UTpUoSystem::GetNetworkNotificationPos
 
 	UTpUoSystem_GetNetworkNotificationPosition_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -9242,11 +7390,7 @@ void UTpUoSystem::ClearExternalUIChangeDelegate(const struct FScriptDelegate& Ex
 	UTpUoSystem_ClearExternalUIChangeDelegate_Params params;
 	params.ExternalUIDelegate = ExternalUIDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9262,11 +7406,7 @@ void UTpUoSystem::AddExternalUIChangeDelegate(const struct FScriptDelegate& Exte
 	UTpUoSystem_AddExternalUIChangeDelegate_Params params;
 	params.ExternalUIDelegate = ExternalUIDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9282,11 +7422,7 @@ void UTpUoSystem::DispatchExternalUIChange(bool bIsOpening)
 	UTpUoSystem_DispatchExternalUIChange_Params params;
 	params.bIsOpening = bIsOpening;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9302,11 +7438,7 @@ void UTpUoSystem::OnExternalUIChange_Remove(const struct FScriptDelegate& D)
 	UTpUoSystem_OnExternalUIChange_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9322,11 +7454,7 @@ void UTpUoSystem::OnExternalUIChange_Add(const struct FScriptDelegate& D)
 	UTpUoSystem_OnExternalUIChange_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9342,11 +7470,7 @@ void UTpUoSystem::OnExternalUIChange_Invoke(bool bIsOpening)
 	UTpUoSystem_OnExternalUIChange_Invoke_Params params;
 	params.bIsOpening = bIsOpening;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9362,11 +7486,7 @@ void UTpUoSystem::OnExternalUIChange(bool bIsOpening)
 	UTpUoSystem_OnExternalUIChange_Params params;
 	params.bIsOpening = bIsOpening;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9382,11 +7502,7 @@ void UTpUoSystem::ClearLinkStatusChangeDelegate(const struct FScriptDelegate& Li
 	UTpUoSystem_ClearLinkStatusChangeDelegate_Params params;
 	params.LinkStatusDelegate = LinkStatusDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9402,11 +7518,7 @@ void UTpUoSystem::AddLinkStatusChangeDelegate(const struct FScriptDelegate& Link
 	UTpUoSystem_AddLinkStatusChangeDelegate_Params params;
 	params.LinkStatusDelegate = LinkStatusDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9422,11 +7534,7 @@ void UTpUoSystem::OnLinkStatusChange_Remove(const struct FScriptDelegate& D)
 	UTpUoSystem_OnLinkStatusChange_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9442,11 +7550,7 @@ void UTpUoSystem::OnLinkStatusChange_Add(const struct FScriptDelegate& D)
 	UTpUoSystem_OnLinkStatusChange_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9462,11 +7566,7 @@ void UTpUoSystem::OnLinkStatusChange_Invoke(bool bIsConnected)
 	UTpUoSystem_OnLinkStatusChange_Invoke_Params params;
 	params.bIsConnected = bIsConnected;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9482,11 +7582,7 @@ void UTpUoSystem::OnLinkStatusChange(bool bIsConnected)
 	UTpUoSystem_OnLinkStatusChange_Params params;
 	params.bIsConnected = bIsConnected;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9501,13 +7597,8 @@ bool UTpUoSystem::HasLinkConnection()
 
 	UTpUoSystem_HasLinkConnection_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -9521,12 +7612,7 @@ void UTpUoSystem::InitializeNative()
 
 	UTpUoSystem_InitializeNative_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9542,11 +7628,7 @@ void UTpUoSystem::Initialize(class UTpSystemBase* InSystemBase)
 	UTpUoSystem_Initialize_Params params;
 	params.InSystemBase = InSystemBase;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9559,11 +7641,7 @@ void UTpOnScreenErrorHandler::Finalize()
 
 	UTpOnScreenErrorHandler_Finalize_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9576,11 +7654,7 @@ void UTpOnScreenErrorHandler::Initialize()
 
 	UTpOnScreenErrorHandler_Initialize_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9596,11 +7670,7 @@ void UTpOnScreenErrorHandler::Tick(float DeltaSeconds)
 	UTpOnScreenErrorHandler_Tick_Params params;
 	params.DeltaSeconds = DeltaSeconds;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9615,12 +7685,8 @@ bool UTpSystem::Init()
 
 	UTpSystem_Init_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -9636,12 +7702,8 @@ TArray<struct FOnlineFileLockerFileInfo> UTpUoFileLocker::ListFileLocker()
 
 	UTpUoFileLocker_ListFileLocker_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -9658,11 +7720,7 @@ void UTpUoFileLocker::ClearOnDeleteFileFromLockerCompleteDelegate(const struct F
 	UTpUoFileLocker_ClearOnDeleteFileFromLockerCompleteDelegate_Params params;
 	params.DeleteFileFromLockerDelegate = DeleteFileFromLockerDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9678,11 +7736,7 @@ void UTpUoFileLocker::Del_OnDeleteFileFromLockerComplete(bool bWasSuccessful)
 	UTpUoFileLocker_Del_OnDeleteFileFromLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9698,11 +7752,7 @@ void UTpUoFileLocker::AddOnDeleteFileFromLockerCompleteDelegate(const struct FSc
 	UTpUoFileLocker_AddOnDeleteFileFromLockerCompleteDelegate_Params params;
 	params.DeleteFileFromLockerDelegate = DeleteFileFromLockerDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9718,11 +7768,7 @@ void UTpUoFileLocker::OnDeleteFileFromLockerComplete_Remove(const struct FScript
 	UTpUoFileLocker_OnDeleteFileFromLockerComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9738,11 +7784,7 @@ void UTpUoFileLocker::OnDeleteFileFromLockerComplete_Add(const struct FScriptDel
 	UTpUoFileLocker_OnDeleteFileFromLockerComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9758,11 +7800,7 @@ void UTpUoFileLocker::OnDeleteFileFromLockerComplete_Invoke(bool bWasSuccessful)
 	UTpUoFileLocker_OnDeleteFileFromLockerComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9778,11 +7816,7 @@ void UTpUoFileLocker::OnDeleteFileFromLockerComplete(bool bWasSuccessful)
 	UTpUoFileLocker_OnDeleteFileFromLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9798,12 +7832,8 @@ bool UTpUoFileLocker::DeleteFileFromLocker(struct FOnlineFileLockerFile* File)
 
 	UTpUoFileLocker_DeleteFileFromLocker_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (File != nullptr)
 		*File = params.File;
 
@@ -9823,11 +7853,7 @@ void UTpUoFileLocker::ClearOnWriteFileToLockerCompleteDelegate(const struct FScr
 	UTpUoFileLocker_ClearOnWriteFileToLockerCompleteDelegate_Params params;
 	params.WriteFileToLockerDelegate = WriteFileToLockerDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9843,11 +7869,7 @@ void UTpUoFileLocker::Del_OnWriteFileToLockerComplete(bool bWasSuccessful)
 	UTpUoFileLocker_Del_OnWriteFileToLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9863,11 +7885,7 @@ void UTpUoFileLocker::AddOnWriteFileToLockerCompleteDelegate(const struct FScrip
 	UTpUoFileLocker_AddOnWriteFileToLockerCompleteDelegate_Params params;
 	params.WriteFileToLockerDelegate = WriteFileToLockerDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9883,11 +7901,7 @@ void UTpUoFileLocker::OnWriteFileToLockerComplete_Remove(const struct FScriptDel
 	UTpUoFileLocker_OnWriteFileToLockerComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9903,11 +7917,7 @@ void UTpUoFileLocker::OnWriteFileToLockerComplete_Add(const struct FScriptDelega
 	UTpUoFileLocker_OnWriteFileToLockerComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9923,11 +7933,7 @@ void UTpUoFileLocker::OnWriteFileToLockerComplete_Invoke(bool bWasSuccessful)
 	UTpUoFileLocker_OnWriteFileToLockerComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9943,11 +7949,7 @@ void UTpUoFileLocker::OnWriteFileToLockerComplete(bool bWasSuccessful)
 	UTpUoFileLocker_OnWriteFileToLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -9963,12 +7965,8 @@ bool UTpUoFileLocker::WriteFileToLocker(struct FOnlineFileLockerFile* File)
 
 	UTpUoFileLocker_WriteFileToLocker_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (File != nullptr)
 		*File = params.File;
 
@@ -9988,11 +7986,7 @@ void UTpUoFileLocker::ClearOnReadFileFromLockerCompleteDelegate(const struct FSc
 	UTpUoFileLocker_ClearOnReadFileFromLockerCompleteDelegate_Params params;
 	params.ReadFileFromLockerDelegate = ReadFileFromLockerDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10008,11 +8002,7 @@ void UTpUoFileLocker::Del_OnReadFileFromLockerComplete(bool bWasSuccessful)
 	UTpUoFileLocker_Del_OnReadFileFromLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10028,11 +8018,7 @@ void UTpUoFileLocker::AddOnReadFileFromLockerCompleteDelegate(const struct FScri
 	UTpUoFileLocker_AddOnReadFileFromLockerCompleteDelegate_Params params;
 	params.ReadFileFromLockerDelegate = ReadFileFromLockerDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10048,11 +8034,7 @@ void UTpUoFileLocker::OnReadFileFromLockerComplete_Remove(const struct FScriptDe
 	UTpUoFileLocker_OnReadFileFromLockerComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10068,11 +8050,7 @@ void UTpUoFileLocker::OnReadFileFromLockerComplete_Add(const struct FScriptDeleg
 	UTpUoFileLocker_OnReadFileFromLockerComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10088,11 +8066,7 @@ void UTpUoFileLocker::OnReadFileFromLockerComplete_Invoke(bool bWasSuccessful)
 	UTpUoFileLocker_OnReadFileFromLockerComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10108,11 +8082,7 @@ void UTpUoFileLocker::OnReadFileFromLockerComplete(bool bWasSuccessful)
 	UTpUoFileLocker_OnReadFileFromLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10128,12 +8098,8 @@ bool UTpUoFileLocker::ReadFileFromLocker(struct FOnlineFileLockerFile* File)
 
 	UTpUoFileLocker_ReadFileFromLocker_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (File != nullptr)
 		*File = params.File;
 
@@ -10153,11 +8119,7 @@ void UTpUoFileLocker::ClearOnFetchLockerCompleteDelegate(const struct FScriptDel
 	UTpUoFileLocker_ClearOnFetchLockerCompleteDelegate_Params params;
 	params.FetchLockerDelegate = FetchLockerDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10173,11 +8135,7 @@ void UTpUoFileLocker::Del_OnFetchLockerComplete(bool bWasSuccessful)
 	UTpUoFileLocker_Del_OnFetchLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10193,11 +8151,7 @@ void UTpUoFileLocker::AddOnFetchLockerCompleteDelegate(const struct FScriptDeleg
 	UTpUoFileLocker_AddOnFetchLockerCompleteDelegate_Params params;
 	params.FetchLockerDelegate = FetchLockerDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10213,11 +8167,7 @@ void UTpUoFileLocker::OnFetchLockerComplete_Remove(const struct FScriptDelegate&
 	UTpUoFileLocker_OnFetchLockerComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10233,11 +8183,7 @@ void UTpUoFileLocker::OnFetchLockerComplete_Add(const struct FScriptDelegate& D)
 	UTpUoFileLocker_OnFetchLockerComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10253,11 +8199,7 @@ void UTpUoFileLocker::OnFetchLockerComplete_Invoke(bool bWasSuccessful)
 	UTpUoFileLocker_OnFetchLockerComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10273,11 +8215,7 @@ void UTpUoFileLocker::OnFetchLockerComplete(bool bWasSuccessful)
 	UTpUoFileLocker_OnFetchLockerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10294,12 +8232,8 @@ bool UTpUoFileLocker::FetchLocker(const struct FString& UserName)
 	UTpUoFileLocker_FetchLocker_Params params;
 	params.UserName = UserName;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -10316,11 +8250,7 @@ void UTpUoFileLocker::Initialize(class UTpSystemBase* InSystemBase)
 	UTpUoFileLocker_Initialize_Params params;
 	params.InSystemBase = InSystemBase;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10338,12 +8268,8 @@ bool UTpUoStats::RegisterStatGuid(const struct FUniqueNetId& PlayerId, struct FS
 	UTpUoStats_RegisterStatGuid_Params params;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (ClientStatGuid != nullptr)
 		*ClientStatGuid = params.ClientStatGuid;
 
@@ -10362,12 +8288,8 @@ struct FString UTpUoStats::GetClientStatGuid()
 
 	UTpUoStats_GetClientStatGuid_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -10384,11 +8306,7 @@ void UTpUoStats::ClearRegisterHostStatGuidCompleteDelegateDelegate(const struct
 	UTpUoStats_ClearRegisterHostStatGuidCompleteDelegateDelegate_Params params;
 	params.RegisterHostStatGuidCompleteDelegate = RegisterHostStatGuidCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10404,11 +8322,7 @@ void UTpUoStats::AddRegisterHostStatGuidCompleteDelegate(const struct FScriptDel
 	UTpUoStats_AddRegisterHostStatGuidCompleteDelegate_Params params;
 	params.RegisterHostStatGuidCompleteDelegate = RegisterHostStatGuidCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10424,11 +8338,7 @@ void UTpUoStats::OnRegisterHostStatGuidComplete(bool bWasSuccessful)
 	UTpUoStats_OnRegisterHostStatGuidComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10444,12 +8354,8 @@ bool UTpUoStats::RegisterHostStatGuid(struct FString* HostStatGuid)
 
 	UTpUoStats_RegisterHostStatGuid_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (HostStatGuid != nullptr)
 		*HostStatGuid = params.HostStatGuid;
 
@@ -10468,12 +8374,8 @@ struct FString UTpUoStats::GetHostStatGuid()
 
 	UTpUoStats_GetHostStatGuid_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -10490,12 +8392,8 @@ bool UTpUoStats::WriteOnlinePlayerScores(TArray<struct FOnlinePlayerScore>* Play
 
 	UTpUoStats_WriteOnlinePlayerScores_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (PlayerScores != nullptr)
 		*PlayerScores = params.PlayerScores;
 
@@ -10515,11 +8413,7 @@ void UTpUoStats::Del_OnFlushOnlineStatsComplete(bool bWasSuccessful)
 	UTpUoStats_Del_OnFlushOnlineStatsComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10535,11 +8429,7 @@ void UTpUoStats::ClearFlushOnlineStatsCompleteDelegate(const struct FScriptDeleg
 	UTpUoStats_ClearFlushOnlineStatsCompleteDelegate_Params params;
 	params.FlushOnlineStatsCompleteDelegate = FlushOnlineStatsCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10555,11 +8445,7 @@ void UTpUoStats::AddFlushOnlineStatsCompleteDelegate(const struct FScriptDelegat
 	UTpUoStats_AddFlushOnlineStatsCompleteDelegate_Params params;
 	params.FlushOnlineStatsCompleteDelegate = FlushOnlineStatsCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10575,11 +8461,7 @@ void UTpUoStats::OnFlushOnlineStatsComplete_Remove(const struct FScriptDelegate&
 	UTpUoStats_OnFlushOnlineStatsComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10595,11 +8477,7 @@ void UTpUoStats::OnFlushOnlineStatsComplete_Add(const struct FScriptDelegate& D)
 	UTpUoStats_OnFlushOnlineStatsComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10615,11 +8493,7 @@ void UTpUoStats::OnFlushOnlineStatsComplete_Invoke(bool bWasSuccessful)
 	UTpUoStats_OnFlushOnlineStatsComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10635,11 +8509,7 @@ void UTpUoStats::OnFlushOnlineStatsComplete(bool bWasSuccessful)
 	UTpUoStats_OnFlushOnlineStatsComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10654,12 +8524,8 @@ bool UTpUoStats::FlushOnlineStats()
 
 	UTpUoStats_FlushOnlineStats_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -10679,12 +8545,8 @@ bool UTpUoStats::WriteOnlineStats(const struct FUniqueNetId& Player, class UOnli
 	params.Player = Player;
 	params.StatsWrite = StatsWrite;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -10701,11 +8563,7 @@ void UTpUoStats::FreeStats(class UOnlineStatsRead* StatsRead)
 	UTpUoStats_FreeStats_Params params;
 	params.StatsRead = StatsRead;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10721,11 +8579,7 @@ void UTpUoStats::OnReadOnlineStatsComplete_Remove(const struct FScriptDelegate&
 	UTpUoStats_OnReadOnlineStatsComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10741,11 +8595,7 @@ void UTpUoStats::OnReadOnlineStatsComplete_Add(const struct FScriptDelegate& D)
 	UTpUoStats_OnReadOnlineStatsComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10761,11 +8611,7 @@ void UTpUoStats::OnReadOnlineStatsComplete_Invoke(bool bWasSuccessful)
 	UTpUoStats_OnReadOnlineStatsComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10781,11 +8627,7 @@ void UTpUoStats::OnReadOnlineStatsComplete(bool bWasSuccessful)
 	UTpUoStats_OnReadOnlineStatsComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10801,11 +8643,7 @@ void UTpUoStats::Del_OnReadOnlineStatsComplete(bool bWasSuccessful)
 	UTpUoStats_Del_OnReadOnlineStatsComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10821,11 +8659,7 @@ void UTpUoStats::ClearReadOnlineStatsCompleteDelegate(const struct FScriptDelega
 	UTpUoStats_ClearReadOnlineStatsCompleteDelegate_Params params;
 	params.ReadOnlineStatsCompleteDelegate = ReadOnlineStatsCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10841,11 +8675,7 @@ void UTpUoStats::AddReadOnlineStatsCompleteDelegate(const struct FScriptDelegate
 	UTpUoStats_AddReadOnlineStatsCompleteDelegate_Params params;
 	params.ReadOnlineStatsCompleteDelegate = ReadOnlineStatsCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10866,12 +8696,8 @@ bool UTpUoStats::ReadOnlineStatsByRankAroundPlayer(unsigned char LocalUserNum, c
 	params.StatsRead = StatsRead;
 	params.NumRows = NumRows;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -10893,12 +8719,8 @@ bool UTpUoStats::ReadOnlineStatsByRank(class UOnlineStatsRead* StatsRead, int St
 	params.StartIndex = StartIndex;
 	params.NumToRead = NumToRead;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -10918,12 +8740,8 @@ bool UTpUoStats::ReadOnlineStatsForFriends(unsigned char LocalUserNum, class UOn
 	params.LocalUserNum = LocalUserNum;
 	params.StatsRead = StatsRead;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -10942,12 +8760,8 @@ bool UTpUoStats::ReadOnlineStats(class UOnlineStatsRead* StatsRead, TArray<struc
 	UTpUoStats_ReadOnlineStats_Params params;
 	params.StatsRead = StatsRead;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Players != nullptr)
 		*Players = params.Players;
 
@@ -10967,11 +8781,7 @@ void UTpUoStats::Initialize(class UTpSystemBase* InSystemBase)
 	UTpUoStats_Initialize_Params params;
 	params.InSystemBase = InSystemBase;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -10984,11 +8794,7 @@ void UTpUoPlayGroup::LeaveGroupGame()
 
 	UTpUoPlayGroup_LeaveGroupGame_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11001,11 +8807,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupGameLeave()
 
 	UTpUoPlayGroup_Del_OnPlayGroupGameLeave_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11021,11 +8823,7 @@ void UTpUoPlayGroup::ClearPlayGroupGameLeaveDelegate(const struct FScriptDelegat
 	UTpUoPlayGroup_ClearPlayGroupGameLeaveDelegate_Params params;
 	params.OnPlayGroupGameLeaveDelegate = OnPlayGroupGameLeaveDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11041,11 +8839,7 @@ void UTpUoPlayGroup::AddPlayGroupGameLeaveDelegate(const struct FScriptDelegate&
 	UTpUoPlayGroup_AddPlayGroupGameLeaveDelegate_Params params;
 	params.OnPlayGroupGameLeaveDelegate = OnPlayGroupGameLeaveDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11061,11 +8855,7 @@ void UTpUoPlayGroup::OnPlayGroupGameLeave_Remove(const struct FScriptDelegate& D
 	UTpUoPlayGroup_OnPlayGroupGameLeave_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11081,11 +8871,7 @@ void UTpUoPlayGroup::OnPlayGroupGameLeave_Add(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupGameLeave_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11098,11 +8884,7 @@ void UTpUoPlayGroup::OnPlayGroupGameLeave_Invoke()
 
 	UTpUoPlayGroup_OnPlayGroupGameLeave_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11115,11 +8897,7 @@ void UTpUoPlayGroup::OnPlayGroupGameLeave()
 
 	UTpUoPlayGroup_OnPlayGroupGameLeave_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11132,11 +8910,7 @@ void UTpUoPlayGroup::JoinGroupGame()
 
 	UTpUoPlayGroup_JoinGroupGame_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11154,11 +8928,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupGameJoined(const struct FTpLobbyRef& InLobby
 	params.InLobby = InLobby;
 	params.InGame = InGame;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11174,11 +8944,7 @@ void UTpUoPlayGroup::ClearPlayGroupGameJoinedDelegate(const struct FScriptDelega
 	UTpUoPlayGroup_ClearPlayGroupGameJoinedDelegate_Params params;
 	params.OnPlayGroupGameJoinedDelegate = OnPlayGroupGameJoinedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11194,11 +8960,7 @@ void UTpUoPlayGroup::AddPlayGroupGameJoinedDelegate(const struct FScriptDelegate
 	UTpUoPlayGroup_AddPlayGroupGameJoinedDelegate_Params params;
 	params.OnPlayGroupGameJoinedDelegate = OnPlayGroupGameJoinedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11214,11 +8976,7 @@ void UTpUoPlayGroup::OnPlayGroupGameJoined_Remove(const struct FScriptDelegate&
 	UTpUoPlayGroup_OnPlayGroupGameJoined_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11234,11 +8992,7 @@ void UTpUoPlayGroup::OnPlayGroupGameJoined_Add(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupGameJoined_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11251,11 +9005,7 @@ void UTpUoPlayGroup::OnPlayGroupGameJoined_Invoke()
 
 	UTpUoPlayGroup_OnPlayGroupGameJoined_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11268,11 +9018,7 @@ void UTpUoPlayGroup::OnPlayGroupGameJoined()
 
 	UTpUoPlayGroup_OnPlayGroupGameJoined_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11285,11 +9031,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupOwnerTransitionFinish()
 
 	UTpUoPlayGroup_Del_OnPlayGroupOwnerTransitionFinish_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11305,11 +9047,7 @@ void UTpUoPlayGroup::ClearPlayGroupOwnerTransitionFinishDelegate(const struct FS
 	UTpUoPlayGroup_ClearPlayGroupOwnerTransitionFinishDelegate_Params params;
 	params.OnPlayGroupOwnerTransitionFinishDelegate = OnPlayGroupOwnerTransitionFinishDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11325,11 +9063,7 @@ void UTpUoPlayGroup::AddPlayGroupOwnerTransitionFinishDelegate(const struct FScr
 	UTpUoPlayGroup_AddPlayGroupOwnerTransitionFinishDelegate_Params params;
 	params.OnPlayGroupOwnerTransitionFinishDelegate = OnPlayGroupOwnerTransitionFinishDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11345,11 +9079,7 @@ void UTpUoPlayGroup::OnPlayGroupOwnerTransitionFinish_Remove(const struct FScrip
 	UTpUoPlayGroup_OnPlayGroupOwnerTransitionFinish_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11365,11 +9095,7 @@ void UTpUoPlayGroup::OnPlayGroupOwnerTransitionFinish_Add(const struct FScriptDe
 	UTpUoPlayGroup_OnPlayGroupOwnerTransitionFinish_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11382,11 +9108,7 @@ void UTpUoPlayGroup::OnPlayGroupOwnerTransitionFinish_Invoke()
 
 	UTpUoPlayGroup_OnPlayGroupOwnerTransitionFinish_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11399,11 +9121,7 @@ void UTpUoPlayGroup::OnPlayGroupOwnerTransitionFinish()
 
 	UTpUoPlayGroup_OnPlayGroupOwnerTransitionFinish_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11416,11 +9134,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupOwnerTransitionStart()
 
 	UTpUoPlayGroup_Del_OnPlayGroupOwnerTransitionStart_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11436,11 +9150,7 @@ void UTpUoPlayGroup::ClearPlayGroupOwnerTransitionStartDelegate(const struct FSc
 	UTpUoPlayGroup_ClearPlayGroupOwnerTransitionStartDelegate_Params params;
 	params.OnPlayGroupOwnerTransitionStartDelegate = OnPlayGroupOwnerTransitionStartDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11456,11 +9166,7 @@ void UTpUoPlayGroup::AddPlayGroupOwnerTransitionStartDelegate(const struct FScri
 	UTpUoPlayGroup_AddPlayGroupOwnerTransitionStartDelegate_Params params;
 	params.OnPlayGroupOwnerTransitionStartDelegate = OnPlayGroupOwnerTransitionStartDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11476,11 +9182,7 @@ void UTpUoPlayGroup::OnPlayGroupOwnerTransitionStart_Remove(const struct FScript
 	UTpUoPlayGroup_OnPlayGroupOwnerTransitionStart_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11496,11 +9198,7 @@ void UTpUoPlayGroup::OnPlayGroupOwnerTransitionStart_Add(const struct FScriptDel
 	UTpUoPlayGroup_OnPlayGroupOwnerTransitionStart_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11513,11 +9211,7 @@ void UTpUoPlayGroup::OnPlayGroupOwnerTransitionStart_Invoke()
 
 	UTpUoPlayGroup_OnPlayGroupOwnerTransitionStart_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11530,11 +9224,7 @@ void UTpUoPlayGroup::OnPlayGroupOwnerTransitionStart()
 
 	UTpUoPlayGroup_OnPlayGroupOwnerTransitionStart_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11550,11 +9240,7 @@ void UTpUoPlayGroup::TransferOwnerShipAsync(const struct FUniqueNetId& NewOwnerI
 	UTpUoPlayGroup_TransferOwnerShipAsync_Params params;
 	params.NewOwnerId = NewOwnerId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11572,11 +9258,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupMemberLeave(const struct FUniqueNetId& UserI
 	params.UserId = UserId;
 	params.Reason = Reason;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11592,11 +9274,7 @@ void UTpUoPlayGroup::ClearPlayGroupMemberLeaveDelegate(const struct FScriptDeleg
 	UTpUoPlayGroup_ClearPlayGroupMemberLeaveDelegate_Params params;
 	params.OnPlayGroupMemberLeaveDelegate = OnPlayGroupMemberLeaveDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11612,11 +9290,7 @@ void UTpUoPlayGroup::AddPlayGroupMemberLeaveDelegate(const struct FScriptDelegat
 	UTpUoPlayGroup_AddPlayGroupMemberLeaveDelegate_Params params;
 	params.OnPlayGroupMemberLeaveDelegate = OnPlayGroupMemberLeaveDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11632,11 +9306,7 @@ void UTpUoPlayGroup::OnPlayGroupMemberLeave_Remove(const struct FScriptDelegate&
 	UTpUoPlayGroup_OnPlayGroupMemberLeave_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11652,11 +9322,7 @@ void UTpUoPlayGroup::OnPlayGroupMemberLeave_Add(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupMemberLeave_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11674,11 +9340,7 @@ void UTpUoPlayGroup::OnPlayGroupMemberLeave_Invoke(const struct FUniqueNetId& Us
 	params.UserId = UserId;
 	params.Reason = Reason;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11696,11 +9358,7 @@ void UTpUoPlayGroup::OnPlayGroupMemberLeave(const struct FUniqueNetId& UserId, T
 	params.UserId = UserId;
 	params.Reason = Reason;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11713,11 +9371,7 @@ void UTpUoPlayGroup::Del_OnLeavePlayGroupComplete()
 
 	UTpUoPlayGroup_Del_OnLeavePlayGroupComplete_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11733,11 +9387,7 @@ void UTpUoPlayGroup::ClearLeavePlayGroupCompleteDelegate(const struct FScriptDel
 	UTpUoPlayGroup_ClearLeavePlayGroupCompleteDelegate_Params params;
 	params.OnLeavePlayGroupCompleteDelegate = OnLeavePlayGroupCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11753,11 +9403,7 @@ void UTpUoPlayGroup::AddLeavePlayGroupCompleteDelegate(const struct FScriptDeleg
 	UTpUoPlayGroup_AddLeavePlayGroupCompleteDelegate_Params params;
 	params.OnLeavePlayGroupCompleteDelegate = OnLeavePlayGroupCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11773,11 +9419,7 @@ void UTpUoPlayGroup::OnLeavePlayGroupComplete_Remove(const struct FScriptDelegat
 	UTpUoPlayGroup_OnLeavePlayGroupComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11793,11 +9435,7 @@ void UTpUoPlayGroup::OnLeavePlayGroupComplete_Add(const struct FScriptDelegate&
 	UTpUoPlayGroup_OnLeavePlayGroupComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11810,11 +9448,7 @@ void UTpUoPlayGroup::OnLeavePlayGroupComplete_Invoke()
 
 	UTpUoPlayGroup_OnLeavePlayGroupComplete_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11827,11 +9461,7 @@ void UTpUoPlayGroup::OnLeavePlayGroupComplete()
 
 	UTpUoPlayGroup_OnLeavePlayGroupComplete_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11844,11 +9474,7 @@ void UTpUoPlayGroup::LeavePlayGroupAsync()
 
 	UTpUoPlayGroup_LeavePlayGroupAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11861,11 +9487,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupKicked()
 
 	UTpUoPlayGroup_Del_OnPlayGroupKicked_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11881,11 +9503,7 @@ void UTpUoPlayGroup::ClearPlayGroupKickedDelegate(const struct FScriptDelegate&
 	UTpUoPlayGroup_ClearPlayGroupKickedDelegate_Params params;
 	params.OnPlayGroupKickedDelegate = OnPlayGroupKickedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11901,11 +9519,7 @@ void UTpUoPlayGroup::AddPlayGroupKickedDelegate(const struct FScriptDelegate& On
 	UTpUoPlayGroup_AddPlayGroupKickedDelegate_Params params;
 	params.OnPlayGroupKickedDelegate = OnPlayGroupKickedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11921,11 +9535,7 @@ void UTpUoPlayGroup::OnPlayGroupKicked_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupKicked_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11941,11 +9551,7 @@ void UTpUoPlayGroup::OnPlayGroupKicked_Add(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupKicked_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11958,11 +9564,7 @@ void UTpUoPlayGroup::OnPlayGroupKicked_Invoke()
 
 	UTpUoPlayGroup_OnPlayGroupKicked_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11975,11 +9577,7 @@ void UTpUoPlayGroup::OnPlayGroupKicked()
 
 	UTpUoPlayGroup_OnPlayGroupKicked_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -11995,11 +9593,7 @@ void UTpUoPlayGroup::KickMemberAsync(const struct FUniqueNetId& UserId)
 	UTpUoPlayGroup_KickMemberAsync_Params params;
 	params.UserId = UserId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12012,11 +9606,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupDestroyed()
 
 	UTpUoPlayGroup_Del_OnPlayGroupDestroyed_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12032,11 +9622,7 @@ void UTpUoPlayGroup::ClearPlayGroupDestroyedDelegate(const struct FScriptDelegat
 	UTpUoPlayGroup_ClearPlayGroupDestroyedDelegate_Params params;
 	params.OnPlayGroupDestroyedDelegate = OnPlayGroupDestroyedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12052,11 +9638,7 @@ void UTpUoPlayGroup::AddPlayGroupDestroyedDelegate(const struct FScriptDelegate&
 	UTpUoPlayGroup_AddPlayGroupDestroyedDelegate_Params params;
 	params.OnPlayGroupDestroyedDelegate = OnPlayGroupDestroyedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12072,11 +9654,7 @@ void UTpUoPlayGroup::OnPlayGroupDestroyed_Remove(const struct FScriptDelegate& D
 	UTpUoPlayGroup_OnPlayGroupDestroyed_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12092,11 +9670,7 @@ void UTpUoPlayGroup::OnPlayGroupDestroyed_Add(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupDestroyed_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12109,11 +9683,7 @@ void UTpUoPlayGroup::OnPlayGroupDestroyed_Invoke()
 
 	UTpUoPlayGroup_OnPlayGroupDestroyed_Invoke_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12126,11 +9696,7 @@ void UTpUoPlayGroup::OnPlayGroupDestroyed()
 
 	UTpUoPlayGroup_OnPlayGroupDestroyed_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12143,11 +9709,7 @@ void UTpUoPlayGroup::DestroyPlayGroupAsync()
 
 	UTpUoPlayGroup_DestroyPlayGroupAsync_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12165,11 +9727,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupChatMessageReceived(const struct FUniqueNetI
 	params.SenderId = SenderId;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12185,11 +9743,7 @@ void UTpUoPlayGroup::ClearPlayGroupChatMessageReceivedDelegate(const struct FScr
 	UTpUoPlayGroup_ClearPlayGroupChatMessageReceivedDelegate_Params params;
 	params.OnPlayGroupChatMessageReceivedDelegate = OnPlayGroupChatMessageReceivedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12205,11 +9759,7 @@ void UTpUoPlayGroup::AddPlayGroupChatMessageReceivedDelegate(const struct FScrip
 	UTpUoPlayGroup_AddPlayGroupChatMessageReceivedDelegate_Params params;
 	params.OnPlayGroupChatMessageReceivedDelegate = OnPlayGroupChatMessageReceivedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12225,11 +9775,7 @@ void UTpUoPlayGroup::OnPlayGroupChatMessageReceived_Remove(const struct FScriptD
 	UTpUoPlayGroup_OnPlayGroupChatMessageReceived_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12245,11 +9791,7 @@ void UTpUoPlayGroup::OnPlayGroupChatMessageReceived_Add(const struct FScriptDele
 	UTpUoPlayGroup_OnPlayGroupChatMessageReceived_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12267,11 +9809,7 @@ void UTpUoPlayGroup::OnPlayGroupChatMessageReceived_Invoke(const struct FUniqueN
 	params.SenderId = SenderId;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12289,11 +9827,7 @@ void UTpUoPlayGroup::OnPlayGroupChatMessageReceived(const struct FUniqueNetId& S
 	params.SenderId = SenderId;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12309,11 +9843,7 @@ void UTpUoPlayGroup::BroadCastChatMessageAsync(const struct FString& Message)
 	UTpUoPlayGroup_BroadCastChatMessageAsync_Params params;
 	params.Message = Message;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12329,11 +9859,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupMemberJoin(const struct FUniqueNetId& NewMem
 	UTpUoPlayGroup_Del_OnPlayGroupMemberJoin_Params params;
 	params.NewMemberUserId = NewMemberUserId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12349,11 +9875,7 @@ void UTpUoPlayGroup::ClearPlayGroupMemberJoinDelegate(const struct FScriptDelega
 	UTpUoPlayGroup_ClearPlayGroupMemberJoinDelegate_Params params;
 	params.OnPlayGroupMemberJoinDelegate = OnPlayGroupMemberJoinDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12369,11 +9891,7 @@ void UTpUoPlayGroup::AddPlayGroupMemberJoinDelegate(const struct FScriptDelegate
 	UTpUoPlayGroup_AddPlayGroupMemberJoinDelegate_Params params;
 	params.OnPlayGroupMemberJoinDelegate = OnPlayGroupMemberJoinDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12389,11 +9907,7 @@ void UTpUoPlayGroup::OnPlayGroupMemberJoin_Remove(const struct FScriptDelegate&
 	UTpUoPlayGroup_OnPlayGroupMemberJoin_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12409,11 +9923,7 @@ void UTpUoPlayGroup::OnPlayGroupMemberJoin_Add(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupMemberJoin_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12429,11 +9939,7 @@ void UTpUoPlayGroup::OnPlayGroupMemberJoin_Invoke(const struct FUniqueNetId& New
 	UTpUoPlayGroup_OnPlayGroupMemberJoin_Invoke_Params params;
 	params.NewMemberUserId = NewMemberUserId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12449,11 +9955,7 @@ void UTpUoPlayGroup::OnPlayGroupMemberJoin(const struct FUniqueNetId& NewMemberU
 	UTpUoPlayGroup_OnPlayGroupMemberJoin_Params params;
 	params.NewMemberUserId = NewMemberUserId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12470,12 +9972,8 @@ bool UTpUoPlayGroup::AcceptInviteToPlayGroup(const struct FUniqueNetId& Requesti
 	UTpUoPlayGroup_AcceptInviteToPlayGroup_Params params;
 	params.RequestingUserId = RequestingUserId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -12492,11 +9990,7 @@ void UTpUoPlayGroup::ClearOnInviteToPlayGroupReceivedDelegate(const struct FScri
 	UTpUoPlayGroup_ClearOnInviteToPlayGroupReceivedDelegate_Params params;
 	params.OnInviteToPlayGroupReceived = OnInviteToPlayGroupReceived;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12512,11 +10006,7 @@ void UTpUoPlayGroup::AddOnInviteToPlayGroupReceivedDelegate(const struct FScript
 	UTpUoPlayGroup_AddOnInviteToPlayGroupReceivedDelegate_Params params;
 	params.OnInviteToPlayGroupReceived = OnInviteToPlayGroupReceived;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12532,11 +10022,7 @@ void UTpUoPlayGroup::OnInviteToPlayGroupReceived_Remove(const struct FScriptDele
 	UTpUoPlayGroup_OnInviteToPlayGroupReceived_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12552,11 +10038,7 @@ void UTpUoPlayGroup::OnInviteToPlayGroupReceived_Add(const struct FScriptDelegat
 	UTpUoPlayGroup_OnInviteToPlayGroupReceived_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12572,11 +10054,7 @@ void UTpUoPlayGroup::OnInviteToPlayGroupReceived_Invoke(const struct FUniqueNetI
 	UTpUoPlayGroup_OnInviteToPlayGroupReceived_Invoke_Params params;
 	params.RequestingUserId = RequestingUserId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12592,11 +10070,7 @@ void UTpUoPlayGroup::OnInviteToPlayGroupReceived(const struct FUniqueNetId& Requ
 	UTpUoPlayGroup_OnInviteToPlayGroupReceived_Params params;
 	params.RequestingUserId = RequestingUserId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12612,11 +10086,7 @@ void UTpUoPlayGroup::OnInviteToPlayGroup(const struct FUniqueNetId& RequestingPl
 	UTpUoPlayGroup_OnInviteToPlayGroup_Params params;
 	params.RequestingPlayer = RequestingPlayer;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12632,11 +10102,7 @@ void UTpUoPlayGroup::ClearOnInviteToPlayGroupCompleteDelegate(const struct FScri
 	UTpUoPlayGroup_ClearOnInviteToPlayGroupCompleteDelegate_Params params;
 	params.OnInviteToPlayGroupComplete = OnInviteToPlayGroupComplete;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12652,11 +10118,7 @@ void UTpUoPlayGroup::AddOnInviteToPlayGroupCompleteDelegate(const struct FScript
 	UTpUoPlayGroup_AddOnInviteToPlayGroupCompleteDelegate_Params params;
 	params.OnInviteToPlayGroupComplete = OnInviteToPlayGroupComplete;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12672,11 +10134,7 @@ void UTpUoPlayGroup::OnInviteToPlayGroupComplete_Remove(const struct FScriptDele
 	UTpUoPlayGroup_OnInviteToPlayGroupComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12692,11 +10150,7 @@ void UTpUoPlayGroup::OnInviteToPlayGroupComplete_Add(const struct FScriptDelegat
 	UTpUoPlayGroup_OnInviteToPlayGroupComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12712,11 +10166,7 @@ void UTpUoPlayGroup::OnInviteToPlayGroupComplete_Invoke(bool bWasSuccessful)
 	UTpUoPlayGroup_OnInviteToPlayGroupComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12732,11 +10182,7 @@ void UTpUoPlayGroup::OnInviteToPlayGroupComplete(bool bWasSuccessful)
 	UTpUoPlayGroup_OnInviteToPlayGroupComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12752,11 +10198,7 @@ void UTpUoPlayGroup::OnInviteSent(bool bInOk)
 	UTpUoPlayGroup_OnInviteSent_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12773,12 +10215,8 @@ bool UTpUoPlayGroup::InviteToPlayGroupAsync(const struct FUniqueNetId& UserId)
 	UTpUoPlayGroup_InviteToPlayGroupAsync_Params params;
 	params.UserId = UserId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -12795,11 +10233,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupJoined(bool bInOk)
 	UTpUoPlayGroup_Del_OnPlayGroupJoined_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12815,11 +10249,7 @@ void UTpUoPlayGroup::ClearPlayGroupJoinedDelegate(const struct FScriptDelegate&
 	UTpUoPlayGroup_ClearPlayGroupJoinedDelegate_Params params;
 	params.OnPlayGroupJoinedDelegate = OnPlayGroupJoinedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12835,11 +10265,7 @@ void UTpUoPlayGroup::AddPlayGroupJoinedDelegate(const struct FScriptDelegate& On
 	UTpUoPlayGroup_AddPlayGroupJoinedDelegate_Params params;
 	params.OnPlayGroupJoinedDelegate = OnPlayGroupJoinedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12855,11 +10281,7 @@ void UTpUoPlayGroup::OnPlayGroupJoined_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupJoined_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12875,11 +10297,7 @@ void UTpUoPlayGroup::OnPlayGroupJoined_Add(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupJoined_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12895,11 +10313,7 @@ void UTpUoPlayGroup::OnPlayGroupJoined_Invoke(bool bInOk)
 	UTpUoPlayGroup_OnPlayGroupJoined_Invoke_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12915,11 +10329,7 @@ void UTpUoPlayGroup::OnPlayGroupJoined(bool bInOk)
 	UTpUoPlayGroup_OnPlayGroupJoined_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12935,11 +10345,7 @@ void UTpUoPlayGroup::JoinPlayGroupAsync(const struct FUniqueNetId& UserId)
 	UTpUoPlayGroup_JoinPlayGroupAsync_Params params;
 	params.UserId = UserId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12955,11 +10361,7 @@ void UTpUoPlayGroup::Del_OnPlayGroupCreated(bool bInOk)
 	UTpUoPlayGroup_Del_OnPlayGroupCreated_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12975,11 +10377,7 @@ void UTpUoPlayGroup::ClearPlayGroupCreatedDelegate(const struct FScriptDelegate&
 	UTpUoPlayGroup_ClearPlayGroupCreatedDelegate_Params params;
 	params.OnPlayGroupCreatedDelegate = OnPlayGroupCreatedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -12995,11 +10393,7 @@ void UTpUoPlayGroup::AddPlayGroupCreatedDelegate(const struct FScriptDelegate& O
 	UTpUoPlayGroup_AddPlayGroupCreatedDelegate_Params params;
 	params.OnPlayGroupCreatedDelegate = OnPlayGroupCreatedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13015,11 +10409,7 @@ void UTpUoPlayGroup::OnPlayGroupCreated_Remove(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupCreated_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13035,11 +10425,7 @@ void UTpUoPlayGroup::OnPlayGroupCreated_Add(const struct FScriptDelegate& D)
 	UTpUoPlayGroup_OnPlayGroupCreated_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13055,11 +10441,7 @@ void UTpUoPlayGroup::OnPlayGroupCreated_Invoke(bool bInOk)
 	UTpUoPlayGroup_OnPlayGroupCreated_Invoke_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13075,11 +10457,7 @@ void UTpUoPlayGroup::OnPlayGroupCreated(bool bInOk)
 	UTpUoPlayGroup_OnPlayGroupCreated_Params params;
 	params.bInOk = bInOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13095,11 +10473,7 @@ void UTpUoPlayGroup::CreatePlayGroupAsync(const struct FPlayGroupCreateParams& P
 	UTpUoPlayGroup_CreatePlayGroupAsync_Params params;
 	params.Params = Params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13114,12 +10488,8 @@ TArray<struct FPlayGroupListEntry> UTpUoPlayGroup::GetMyPlayGroupList()
 
 	UTpUoPlayGroup_GetMyPlayGroupList_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -13135,12 +10505,8 @@ bool UTpUoPlayGroup::IsPlayGroupOwner()
 
 	UTpUoPlayGroup_IsPlayGroupOwner_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -13156,12 +10522,8 @@ bool UTpUoPlayGroup::IsInPlayGroup()
 
 	UTpUoPlayGroup_IsInPlayGroup_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -13178,11 +10540,7 @@ void UTpUoPlayGroup::Initialize(class UTpSystemBase* InSystemBase)
 	UTpUoPlayGroup_Initialize_Params params;
 	params.InSystemBase = InSystemBase;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13198,12 +10556,8 @@ bool UTpUoGame::RecalculateSkillRating(TArray<struct FUniqueNetId>* Players)
 
 	UTpUoGame_RecalculateSkillRating_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (Players != nullptr)
 		*Players = params.Players;
 
@@ -13224,12 +10578,8 @@ bool UTpUoGame::AcceptGameInvite(unsigned char LocalUserNum)
 	UTpUoGame_AcceptGameInvite_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -13246,11 +10596,7 @@ void UTpUoGame::OnGameInviteAccepted_Remove(const struct FScriptDelegate& D)
 	UTpUoGame_OnGameInviteAccepted_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13266,11 +10612,7 @@ void UTpUoGame::OnGameInviteAccepted_Add(const struct FScriptDelegate& D)
 	UTpUoGame_OnGameInviteAccepted_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13286,11 +10628,7 @@ void UTpUoGame::OnGameInviteAccepted_Invoke(class UOnlineGameSettings* GameInvit
 	UTpUoGame_OnGameInviteAccepted_Invoke_Params params;
 	params.GameInviteSettings = GameInviteSettings;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13306,11 +10644,7 @@ void UTpUoGame::OnGameInviteAccepted(class UOnlineGameSettings* GameInviteSettin
 	UTpUoGame_OnGameInviteAccepted_Params params;
 	params.GameInviteSettings = GameInviteSettings;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13328,11 +10662,7 @@ void UTpUoGame::ClearGameInviteAcceptedDelegate(unsigned char LocalUserNum, cons
 	params.LocalUserNum = LocalUserNum;
 	params.GameInviteAcceptedDelegate = GameInviteAcceptedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13350,11 +10680,7 @@ void UTpUoGame::AddGameInviteAcceptedDelegate(unsigned char LocalUserNum, const
 	params.LocalUserNum = LocalUserNum;
 	params.GameInviteAcceptedDelegate = GameInviteAcceptedDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13369,12 +10695,8 @@ TArray<struct FOnlineArbitrationRegistrant> UTpUoGame::GetArbitratedPlayers()
 
 	UTpUoGame_GetArbitratedPlayers_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -13391,11 +10713,7 @@ void UTpUoGame::ClearArbitrationRegistrationCompleteDelegate(const struct FScrip
 	UTpUoGame_ClearArbitrationRegistrationCompleteDelegate_Params params;
 	params.ArbitrationRegistrationCompleteDelegate = ArbitrationRegistrationCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13411,11 +10729,7 @@ void UTpUoGame::AddArbitrationRegistrationCompleteDelegate(const struct FScriptD
 	UTpUoGame_AddArbitrationRegistrationCompleteDelegate_Params params;
 	params.ArbitrationRegistrationCompleteDelegate = ArbitrationRegistrationCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13431,11 +10745,7 @@ void UTpUoGame::OnArbitrationRegistrationComplete(bool bWasSuccessful)
 	UTpUoGame_OnArbitrationRegistrationComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13450,12 +10760,8 @@ bool UTpUoGame::RegisterForArbitration()
 
 	UTpUoGame_RegisterForArbitration_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -13471,12 +10777,8 @@ TEnumAsByte<EOnlineGameState> UTpUoGame::GetOnlineGameState()
 
 	UTpUoGame_GetOnlineGameState_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -13493,11 +10795,7 @@ void UTpUoGame::ClearEndOnlineGameCompleteDelegate(const struct FScriptDelegate&
 	UTpUoGame_ClearEndOnlineGameCompleteDelegate_Params params;
 	params.EndOnlineGameCompleteDelegate = EndOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13513,11 +10811,7 @@ void UTpUoGame::AddEndOnlineGameCompleteDelegate(const struct FScriptDelegate& E
 	UTpUoGame_AddEndOnlineGameCompleteDelegate_Params params;
 	params.EndOnlineGameCompleteDelegate = EndOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13533,11 +10827,7 @@ void UTpUoGame::OnEndOnlineGameComplete_Remove(const struct FScriptDelegate& D)
 	UTpUoGame_OnEndOnlineGameComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13553,11 +10843,7 @@ void UTpUoGame::OnEndOnlineGameComplete_Add(const struct FScriptDelegate& D)
 	UTpUoGame_OnEndOnlineGameComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13573,11 +10859,7 @@ void UTpUoGame::OnEndOnlineGameComplete_Invoke(bool bWasSuccessful)
 	UTpUoGame_OnEndOnlineGameComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13593,11 +10875,7 @@ void UTpUoGame::OnEndOnlineGameComplete(bool bWasSuccessful)
 	UTpUoGame_OnEndOnlineGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13613,11 +10891,7 @@ void UTpUoGame::OnEndOnlineGame(bool bOk)
 	UTpUoGame_OnEndOnlineGame_Params params;
 	params.bOk = bOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13632,12 +10906,8 @@ bool UTpUoGame::EndOnlineGame()
 
 	UTpUoGame_EndOnlineGame_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -13654,11 +10924,7 @@ void UTpUoGame::ClearStartOnlineGameCompleteDelegate(const struct FScriptDelegat
 	UTpUoGame_ClearStartOnlineGameCompleteDelegate_Params params;
 	params.StartOnlineGameCompleteDelegate = StartOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13674,11 +10940,7 @@ void UTpUoGame::AddStartOnlineGameCompleteDelegate(const struct FScriptDelegate&
 	UTpUoGame_AddStartOnlineGameCompleteDelegate_Params params;
 	params.StartOnlineGameCompleteDelegate = StartOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13694,11 +10956,7 @@ void UTpUoGame::OnStartOnlineGameComplete_Remove(const struct FScriptDelegate& D
 	UTpUoGame_OnStartOnlineGameComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13714,11 +10972,7 @@ void UTpUoGame::OnStartOnlineGameComplete_Add(const struct FScriptDelegate& D)
 	UTpUoGame_OnStartOnlineGameComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13734,11 +10988,7 @@ void UTpUoGame::OnStartOnlineGameComplete_Invoke(bool bWasSuccessful)
 	UTpUoGame_OnStartOnlineGameComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13754,11 +11004,7 @@ void UTpUoGame::OnStartOnlineGameComplete(bool bWasSuccessful)
 	UTpUoGame_OnStartOnlineGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13774,11 +11020,7 @@ void UTpUoGame::OnStartOnlineGame(bool bOk)
 	UTpUoGame_OnStartOnlineGame_Params params;
 	params.bOk = bOk;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13793,12 +11035,8 @@ bool UTpUoGame::StartOnlineGame()
 
 	UTpUoGame_StartOnlineGame_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -13815,11 +11053,7 @@ void UTpUoGame::ClearUnregisterPlayerCompleteDelegate(const struct FScriptDelega
 	UTpUoGame_ClearUnregisterPlayerCompleteDelegate_Params params;
 	params.UnregisterPlayerCompleteDelegate = UnregisterPlayerCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13835,11 +11069,7 @@ void UTpUoGame::AddUnregisterPlayerCompleteDelegate(const struct FScriptDelegate
 	UTpUoGame_AddUnregisterPlayerCompleteDelegate_Params params;
 	params.UnregisterPlayerCompleteDelegate = UnregisterPlayerCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13855,11 +11085,7 @@ void UTpUoGame::OnUnregisterPlayerComplete_Remove(const struct FScriptDelegate&
 	UTpUoGame_OnUnregisterPlayerComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13875,11 +11101,7 @@ void UTpUoGame::OnUnregisterPlayerComplete_Add(const struct FScriptDelegate& D)
 	UTpUoGame_OnUnregisterPlayerComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13895,11 +11117,7 @@ void UTpUoGame::OnUnregisterPlayerComplete_Invoke(bool bWasSuccessful)
 	UTpUoGame_OnUnregisterPlayerComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13915,11 +11133,7 @@ void UTpUoGame::OnUnregisterPlayerComplete(bool bWasSuccessful)
 	UTpUoGame_OnUnregisterPlayerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13936,12 +11150,8 @@ bool UTpUoGame::UnregisterPlayer(const struct FUniqueNetId& PlayerId)
 	UTpUoGame_UnregisterPlayer_Params params;
 	params.PlayerId = PlayerId;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -13958,11 +11168,7 @@ void UTpUoGame::ClearRegisterPlayerCompleteDelegate(const struct FScriptDelegate
 	UTpUoGame_ClearRegisterPlayerCompleteDelegate_Params params;
 	params.RegisterPlayerCompleteDelegate = RegisterPlayerCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13978,11 +11184,7 @@ void UTpUoGame::AddRegisterPlayerCompleteDelegate(const struct FScriptDelegate&
 	UTpUoGame_AddRegisterPlayerCompleteDelegate_Params params;
 	params.RegisterPlayerCompleteDelegate = RegisterPlayerCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -13998,11 +11200,7 @@ void UTpUoGame::OnRegisterPlayerComplete_Remove(const struct FScriptDelegate& D)
 	UTpUoGame_OnRegisterPlayerComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14018,11 +11216,7 @@ void UTpUoGame::OnRegisterPlayerComplete_Add(const struct FScriptDelegate& D)
 	UTpUoGame_OnRegisterPlayerComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14038,11 +11232,7 @@ void UTpUoGame::OnRegisterPlayerComplete_Invoke(bool bWasSuccessful)
 	UTpUoGame_OnRegisterPlayerComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14058,11 +11248,7 @@ void UTpUoGame::OnRegisterPlayerComplete(bool bWasSuccessful)
 	UTpUoGame_OnRegisterPlayerComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14081,12 +11267,8 @@ bool UTpUoGame::RegisterPlayer(const struct FUniqueNetId& PlayerId, bool bWasInv
 	params.PlayerId = PlayerId;
 	params.bWasInvited = bWasInvited;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -14103,12 +11285,8 @@ bool UTpUoGame::GetResolvedConnectString(struct FString* ConnectInfo)
 
 	UTpUoGame_GetResolvedConnectString_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (ConnectInfo != nullptr)
 		*ConnectInfo = params.ConnectInfo;
 
@@ -14128,11 +11306,7 @@ void UTpUoGame::ClearJoinOnlineGameCompleteDelegate(const struct FScriptDelegate
 	UTpUoGame_ClearJoinOnlineGameCompleteDelegate_Params params;
 	params.JoinOnlineGameCompleteDelegate = JoinOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14148,11 +11322,7 @@ void UTpUoGame::AddJoinOnlineGameCompleteDelegate(const struct FScriptDelegate&
 	UTpUoGame_AddJoinOnlineGameCompleteDelegate_Params params;
 	params.JoinOnlineGameCompleteDelegate = JoinOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14168,11 +11338,7 @@ void UTpUoGame::OnJoinOnlineGameComplete_Remove(const struct FScriptDelegate& D)
 	UTpUoGame_OnJoinOnlineGameComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14188,11 +11354,7 @@ void UTpUoGame::OnJoinOnlineGameComplete_Add(const struct FScriptDelegate& D)
 	UTpUoGame_OnJoinOnlineGameComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14208,11 +11370,7 @@ void UTpUoGame::OnJoinOnlineGameComplete_Invoke(bool bWasSuccessful)
 	UTpUoGame_OnJoinOnlineGameComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14228,11 +11386,7 @@ void UTpUoGame::OnJoinOnlineGameComplete(bool bWasSuccessful)
 	UTpUoGame_OnJoinOnlineGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14250,12 +11404,8 @@ bool UTpUoGame::JoinOnlineGame(unsigned char PlayerNum, struct FOnlineGameSearch
 	UTpUoGame_JoinOnlineGame_Params params;
 	params.PlayerNum = PlayerNum;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (DesiredGame != nullptr)
 		*DesiredGame = params.DesiredGame;
 
@@ -14276,12 +11426,8 @@ bool UTpUoGame::FreeSearchResults(class UOnlineGameSearch* Search)
 	UTpUoGame_FreeSearchResults_Params params;
 	params.Search = Search;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -14298,11 +11444,7 @@ void UTpUoGame::ClearCancelFindOnlineGamesCompleteDelegate(const struct FScriptD
 	UTpUoGame_ClearCancelFindOnlineGamesCompleteDelegate_Params params;
 	params.CancelFindOnlineGamesCompleteDelegate = CancelFindOnlineGamesCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14317,12 +11459,8 @@ class UOnlineGameSearch* UTpUoGame::GetGameSearch()
 
 	UTpUoGame_GetGameSearch_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -14339,11 +11477,7 @@ void UTpUoGame::AddCancelFindOnlineGamesCompleteDelegate(const struct FScriptDel
 	UTpUoGame_AddCancelFindOnlineGamesCompleteDelegate_Params params;
 	params.CancelFindOnlineGamesCompleteDelegate = CancelFindOnlineGamesCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14359,11 +11493,7 @@ void UTpUoGame::OnCancelFindOnlineGamesComplete(bool bWasSuccessful)
 	UTpUoGame_OnCancelFindOnlineGamesComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14378,12 +11508,8 @@ bool UTpUoGame::CancelFindOnlineGames()
 
 	UTpUoGame_CancelFindOnlineGames_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -14400,11 +11526,7 @@ void UTpUoGame::ClearFindOnlineGamesCompleteDelegate(const struct FScriptDelegat
 	UTpUoGame_ClearFindOnlineGamesCompleteDelegate_Params params;
 	params.FindOnlineGamesCompleteDelegate = FindOnlineGamesCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14420,11 +11542,7 @@ void UTpUoGame::AddFindOnlineGamesCompleteDelegate(const struct FScriptDelegate&
 	UTpUoGame_AddFindOnlineGamesCompleteDelegate_Params params;
 	params.FindOnlineGamesCompleteDelegate = FindOnlineGamesCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14440,11 +11558,7 @@ void UTpUoGame::OnFindOnlineGamesComplete_Remove(const struct FScriptDelegate& D
 	UTpUoGame_OnFindOnlineGamesComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14460,11 +11574,7 @@ void UTpUoGame::OnFindOnlineGamesComplete_Add(const struct FScriptDelegate& D)
 	UTpUoGame_OnFindOnlineGamesComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14480,11 +11590,7 @@ void UTpUoGame::OnFindOnlineGamesComplete_Invoke(bool bWasSuccessful)
 	UTpUoGame_OnFindOnlineGamesComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14500,11 +11606,7 @@ void UTpUoGame::OnFindOnlineGamesComplete(bool bWasSuccessful)
 	UTpUoGame_OnFindOnlineGamesComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14523,12 +11625,8 @@ bool UTpUoGame::FindOnlineGames(unsigned char SearchingPlayerNum, class UOnlineG
 	params.SearchingPlayerNum = SearchingPlayerNum;
 	params.SearchSettings = SearchSettings;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -14545,11 +11643,7 @@ void UTpUoGame::ClearDestroyOnlineGameCompleteDelegate(const struct FScriptDeleg
 	UTpUoGame_ClearDestroyOnlineGameCompleteDelegate_Params params;
 	params.DestroyOnlineGameCompleteDelegate = DestroyOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14565,11 +11659,7 @@ void UTpUoGame::AddDestroyOnlineGameCompleteDelegate(const struct FScriptDelegat
 	UTpUoGame_AddDestroyOnlineGameCompleteDelegate_Params params;
 	params.DestroyOnlineGameCompleteDelegate = DestroyOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14585,11 +11675,7 @@ void UTpUoGame::OnDestroyOnlineGameComplete_Remove(const struct FScriptDelegate&
 	UTpUoGame_OnDestroyOnlineGameComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14605,11 +11691,7 @@ void UTpUoGame::OnDestroyOnlineGameComplete_Add(const struct FScriptDelegate& D)
 	UTpUoGame_OnDestroyOnlineGameComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14625,11 +11707,7 @@ void UTpUoGame::OnDestroyOnlineGameComplete_Invoke(bool bWasSuccessful)
 	UTpUoGame_OnDestroyOnlineGameComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14645,11 +11723,7 @@ void UTpUoGame::OnDestroyOnlineGameComplete(bool bWasSuccessful)
 	UTpUoGame_OnDestroyOnlineGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14664,12 +11738,8 @@ bool UTpUoGame::DestroyOnlineGame()
 
 	UTpUoGame_DestroyOnlineGame_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -14685,12 +11755,8 @@ class UOnlineGameSettings* UTpUoGame::GetGameSettings()
 
 	UTpUoGame_GetGameSettings_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -14708,12 +11774,8 @@ bool UTpUoGame::UpdateOnlineGame(class UOnlineGameSettings* UpdatedGameSettings)
 	UTpUoGame_UpdateOnlineGame_Params params;
 	params.UpdatedGameSettings = UpdatedGameSettings;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -14730,11 +11792,7 @@ void UTpUoGame::ClearCreateOnlineGameCompleteDelegate(const struct FScriptDelega
 	UTpUoGame_ClearCreateOnlineGameCompleteDelegate_Params params;
 	params.CreateOnlineGameCompleteDelegate = CreateOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14750,11 +11808,7 @@ void UTpUoGame::AddCreateOnlineGameCompleteDelegate(const struct FScriptDelegate
 	UTpUoGame_AddCreateOnlineGameCompleteDelegate_Params params;
 	params.CreateOnlineGameCompleteDelegate = CreateOnlineGameCompleteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14770,11 +11824,7 @@ void UTpUoGame::OnCreateOnlineGameComplete_Remove(const struct FScriptDelegate&
 	UTpUoGame_OnCreateOnlineGameComplete_Remove_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14790,11 +11840,7 @@ void UTpUoGame::OnCreateOnlineGameComplete_Add(const struct FScriptDelegate& D)
 	UTpUoGame_OnCreateOnlineGameComplete_Add_Params params;
 	params.D = D;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14810,11 +11856,7 @@ void UTpUoGame::OnCreateOnlineGameComplete_Invoke(bool bWasSuccessful)
 	UTpUoGame_OnCreateOnlineGameComplete_Invoke_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14830,11 +11872,7 @@ void UTpUoGame::OnCreateOnlineGameComplete(bool bWasSuccessful)
 	UTpUoGame_OnCreateOnlineGameComplete_Params params;
 	params.bWasSuccessful = bWasSuccessful;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -14853,12 +11891,8 @@ bool UTpUoGame::CreateOnlineGame(unsigned char HostingPlayerNum, class UOnlineGa
 	params.HostingPlayerNum = HostingPlayerNum;
 	params.NewGameSettings = NewGameSettings;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -14875,11 +11909,7 @@ void UTpUoGame::Initialize(class UTpSystemBase* InSystemBase)
 	UTpUoGame_Initialize_Params params;
 	params.InSystemBase = InSystemBase;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -28,12 +28,7 @@ void UTsSystem::UnlockTrophyAsync(int InContext, int InHandle, int InTrophyId)
 	params.InHandle = InHandle;
 	params.InTrophyId = InTrophyId;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -51,12 +46,7 @@ void UTsSystem::InitTrophyAsync(int InContext, int InHandle)
 	params.InContext = InContext;
 	params.InHandle = InHandle;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -74,12 +64,7 @@ void UTsSystem::CopyProfileSettings(class UOnlineProfileSettings* Src, class UOn
 	params.Src = Src;
 	params.Dest = Dest;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -97,13 +82,8 @@ bool UTsSystem::ReadProfileSettings(unsigned char LocalUserNum, class UOnlinePro
 	UTsSystem_ReadProfileSettings_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (ProfileSettings != nullptr)
 		*ProfileSettings = params.ProfileSettings;
 
@@ -125,13 +105,8 @@ bool UTsSystem::WriteProfileSettings(unsigned char LocalUserNum, class UOnlinePr
 	UTsSystem_WriteProfileSettings_Params params;
 	params.LocalUserNum = LocalUserNum;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (ProfileSettings != nullptr)
 		*ProfileSettings = params.ProfileSettings;
 
@@ -151,12 +126,7 @@ void UTsSystem::ReadSPData(const struct FScriptDelegate& ReadComplete)
 	UTsSystem_ReadSPData_Params params;
 	params.ReadComplete = ReadComplete;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -173,13 +143,8 @@ void UTsSystem::WriteSPData(const struct FScriptDelegate& SaveComplete, struct F
 	UTsSystem_WriteSPData_Params params;
 	params.SaveComplete = SaveComplete;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (InData != nullptr)
 		*InData = params.InData;
 }
@@ -201,12 +166,7 @@ void UTsSystem::ReadSaveData(TEnumAsByte<ETsSaveType> SaveType, int Id, const st
 	params.Id = Id;
 	params.ReadComplete = ReadComplete;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -223,13 +183,8 @@ void UTsSystem::WriteSaveData(const struct FScriptDelegate& AddComplete, struct
 	UTsSystem_WriteSaveData_Params params;
 	params.AddComplete = AddComplete;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (InData != nullptr)
 		*InData = params.InData;
 }
@@ -251,12 +206,7 @@ void UTsSystem::InitializeToC(unsigned char LocalUserNum, bool bAutoReplaceCorru
 	params.bAutoReplaceCorrupt = bAutoReplaceCorrupt;
 	params.InitializeComplete = InitializeComplete;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -271,13 +221,8 @@ bool UTsSystem::CheckStorageDevice()
 
 	UTsSystem_CheckStorageDevice_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -291,12 +236,7 @@ void UTsSystem::Initialize()
 
 	UTsSystem_Initialize_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -312,11 +252,7 @@ void UTsSystem::UnRegisterOnDiskAccessDelegate(const struct FScriptDelegate& Dis
 	UTsSystem_UnRegisterOnDiskAccessDelegate_Params params;
 	params.DiskAccessDelegate = DiskAccessDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -332,11 +268,7 @@ void UTsSystem::RegisterOnDiskAccessDelegate(const struct FScriptDelegate& DiskA
 	UTsSystem_RegisterOnDiskAccessDelegate_Params params;
 	params.DiskAccessDelegate = DiskAccessDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -354,11 +286,7 @@ void UTsSystem::OnDiskAccess(bool IsAccessing, TEnumAsByte<ETsDiskAccess> Access
 	params.IsAccessing = IsAccessing;
 	params.AccessType = AccessType;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -373,12 +301,8 @@ bool UTsSystem::IsNoSaving()
 
 	UTsSystem_IsNoSaving_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -395,12 +319,7 @@ void UTsSystem::SetNoSaving(bool bValue)
 	UTsSystem_SetNoSaving_Params params;
 	params.bValue = bValue;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -415,12 +334,8 @@ bool UTsSystem::IsCorruptProfileDetected()
 
 	UTsSystem_IsCorruptProfileDetected_Params params;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -434,12 +349,7 @@ void UTsSystem::ClearCachedProfile()
 
 	UTsSystem_ClearCachedProfile_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -455,11 +365,7 @@ void UTsSystem::UnRegisterReadProfileSettingsDelegate(const struct FScriptDelega
 	UTsSystem_UnRegisterReadProfileSettingsDelegate_Params params;
 	params.ReadDelegate = ReadDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -475,11 +381,7 @@ void UTsSystem::RegisterReadProfileSettingsDelegate(const struct FScriptDelegate
 	UTsSystem_RegisterReadProfileSettingsDelegate_Params params;
 	params.ReadDelegate = ReadDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -495,11 +397,7 @@ void UTsSystem::UnRegisterWriteProfileSettingsDelegate(const struct FScriptDeleg
 	UTsSystem_UnRegisterWriteProfileSettingsDelegate_Params params;
 	params.WriteDelegate = WriteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -515,11 +413,7 @@ void UTsSystem::RegisterWriteProfileSettingsDelegate(const struct FScriptDelegat
 	UTsSystem_RegisterWriteProfileSettingsDelegate_Params params;
 	params.WriteDelegate = WriteDelegate;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -535,11 +429,7 @@ void UTsSystem::OnReadProfileSettingsComplete(TEnumAsByte<ETsResult> Result)
 	UTsSystem_OnReadProfileSettingsComplete_Params params;
 	params.Result = Result;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -555,11 +445,7 @@ void UTsSystem::OnWriteProfileSettingsComplete(TEnumAsByte<ETsResult> Result)
 	UTsSystem_OnWriteProfileSettingsComplete_Params params;
 	params.Result = Result;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -577,11 +463,7 @@ void UTsSystem::OnReadDataComplete(TEnumAsByte<ETsResult> Result, TArray<unsigne
 	params.Result = Result;
 	params.ReadBuffer = ReadBuffer;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -597,11 +479,7 @@ void UTsSystem::OnWriteDataComplete(TEnumAsByte<ETsResult> Result)
 	UTsSystem_OnWriteDataComplete_Params params;
 	params.Result = Result;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -617,11 +495,7 @@ void UTsSystem::OnInitializeComplete(TEnumAsByte<ETsResult> Result)
 	UTsSystem_OnInitializeComplete_Params params;
 	params.Result = Result;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -637,12 +511,7 @@ void UTsSystem::ProcessTick(float DeltaTime)
 	UTsSystem_ProcessTick_Params params;
 	params.DeltaTime = DeltaTime;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -655,12 +524,7 @@ void UTsSystem::DisableSystem()
 
 	UTsSystem_DisableSystem_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -676,13 +540,8 @@ TEnumAsByte<ETsError> UTsSystem::STATIC_GetLastError(struct FString* ErrorString
 
 	UTsSystem_GetLastError_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	if (ErrorString != nullptr)
 		*ErrorString = params.ErrorString;
 
@@ -701,13 +560,8 @@ bool UTsSystem::HasPendingSaveTasks()
 
 	UTsSystem_HasPendingSaveTasks_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -723,13 +577,8 @@ class UTsSystem* UTsSystem::STATIC_GetTsSystem()
 
 	UTsSystem_GetTsSystem_Params params;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
 
-	fn->FunctionFlags = flags;
-
 	return params.ReturnValue;
 }
 
@@ -746,12 +595,7 @@ void UTsSystem::STATIC_SetTsSystem(class UTsSystem* Ts)
 	UTsSystem_SetTsSystem_Params params;
 	params.Ts = Ts;
 
-	auto flags = fn->FunctionFlags;
-	fn->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -767,11 +611,7 @@ void UTsTester::MultiWrite3Done(TEnumAsByte<ETsResult> Result)
 	UTsTester_MultiWrite3Done_Params params;
 	params.Result = Result;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -787,11 +627,7 @@ void UTsTester::MultiWrite2Done(TEnumAsByte<ETsResult> Result)
 	UTsTester_MultiWrite2Done_Params params;
 	params.Result = Result;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -807,11 +643,7 @@ void UTsTester::MultiWrite1Done(TEnumAsByte<ETsResult> Result)
 	UTsTester_MultiWrite1Done_Params params;
 	params.Result = Result;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -827,11 +659,7 @@ void UTsTester::TestMultiWrite(int Size)
 	UTsTester_TestMultiWrite_Params params;
 	params.Size = Size;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -849,11 +677,7 @@ void UTsTester::TestReadDone(TEnumAsByte<ETsResult> Result, TArray<unsigned char
 	params.Result = Result;
 	params.ReadBuffer = ReadBuffer;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -869,11 +693,7 @@ void UTsTester::TestRead(int Id)
 	UTsTester_TestRead_Params params;
 	params.Id = Id;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -889,11 +709,7 @@ void UTsTester::TestWriteDone(TEnumAsByte<ETsResult> Result)
 	UTsTester_TestWriteDone_Params params;
 	params.Result = Result;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -911,11 +727,7 @@ void UTsTester::TestWrite(int Id, int Size)
 	params.Id = Id;
 	params.Size = Size;
 
-	auto flags = fn->FunctionFlags;
-
 	UObject::ProcessEvent(fn, &params);
-
-	fn->FunctionFlags = flags;
 }
 
 
@@ -1,13 +1,43 @@
 #include <fstream>
 #include <Windows.h>
 
+#include <condition_variable>
 #include <filesystem>
+#include <mutex>
+#include <thread>
 
 #include "settings.h"
 
+// Changes are written behind by a flusher thread, which waits for them to
+// settle so bursts of changes cost a single write
+static const DWORD FlushDelay = 500;
+
 static json settings;
 
-static std::string GetSettingsPath() 
+struct Persistence
+{
+	std::mutex Mutex;
+	std::condition_variable Changed;
+	bool Dirty = false;
+	bool Started = false;
+	bool Loaded = false;
+
+	// Set once the first handle is destroyed at exit. The handles aren't
+	// deregistered, so nothing may touch them after that
+	std::atomic<bool> Closed{false};
+
+	std::vector<Settings::Handle *> Handles;
+};
+
+// Function local, handles register themselves during static initialisation.
+// Leaked so it outlives the handles, which are destroyed at exit
+static Persistence &GetPersistence()
+{
+	static const auto persistence = new Persistence();
+	return *persistence;
+}
+
+std::string Settings::GetDirectory() 
 {
 	static std::string path = "";
 
@@ -29,15 +59,32 @@ static std::string GetSettingsPath()
 			std::filesystem::create_directories(settingsPath);
 		}
 
-		settingsPath += "\\mmultiplayer-settings.json";
 		path = settingsPath;
 	}
 
 	return path;
 }
 
+static std::string GetSettingsPath() 
+{
+	const auto directory = Settings::GetDirectory();
+	return directory.empty() ? directory : directory + "\\mmultiplayer-settings.json";
+}
+
+// Expects the persistence mutex to be held
+static void MarkDirty()
+{
+	auto &persistence = GetPersistence();
+
+	persistence.Dirty = true;
+	persistence.Changed.notify_one();
+}
+
 void Settings::SetSetting(const std::vector<std::string> &keys, const json &value) 
 {
+	auto &persistence = GetPersistence();
+	std::lock_guard<std::mutex> lock(persistence.Mutex);
+
 	json* current = &settings;
 	for (const auto& key : keys) 
 	{
@@ -49,12 +96,16 @@ void Settings::SetSetting(const std::vector<std::string> &keys, const json &valu
 	}
 	*current = value;
 
-	Settings::Save();
+	MarkDirty();
 }
 
 json Settings::GetSetting(const std::vector<std::string> &keys, const json &defaultValue)
 {
+	auto &persistence = GetPersistence();
+	std::lock_guard<std::mutex> lock(persistence.Mutex);
+
 	json* current = &settings;
+	auto added = false;
 
 	for (size_t i = 0; i < keys.size(); ++i) 
 	{
@@ -68,15 +119,76 @@ json Settings::GetSetting(const std::vector<std::string> &keys, const json &defa
 			{
 				(*current)[keys[i]] = json::object();
 			}
+
+			added = true;
 		}
 
 		current = &((*current)[keys[i]]);
 	}
 
-	Settings::Save();
+	// Only new defaults need to be written out
+	if (added)
+	{
+		MarkDirty();
+	}
+
 	return *current;
 }
 
+Settings::Handle::Handle(std::initializer_list<std::string> keys)
+{
+	for (const auto &key : keys)
+	{
+		Pointer /= key;
+	}
+}
+
+void Settings::Handle::Register()
+{
+	auto &persistence = GetPersistence();
+	std::lock_guard<std::mutex> lock(persistence.Mutex);
+	persistence.Handles.push_back(this);
+
+	// Handles declared after the settings were loaded pick up their value now
+	if (persistence.Loaded && Load(settings))
+	{
+		::MarkDirty();
+	}
+}
+
+// Handles are static, so this only runs during static destruction at exit. The
+// flusher thread may have been killed holding the lock by then, so instead of
+// deregistering, the store stops using every handle
+Settings::Handle::~Handle()
+{
+	GetPersistence().Closed = true;
+}
+
+void Settings::Handle::MarkDirty()
+{
+	Dirty = true;
+
+	auto &persistence = GetPersistence();
+	std::lock_guard<std::mutex> lock(persistence.Mutex);
+	::MarkDirty();
+}
+
+static void Flusher()
+{
+	auto &persistence = GetPersistence();
+
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(persistence.Mutex);
+			persistence.Changed.wait(lock, [&persistence] { return persistence.Dirty; });
+		}
+
+		Sleep(FlushDelay);
+		Settings::Flush();
+	}
+}
+
 void Settings::Load() 
 {
 	bool reset = true;
@@ -97,24 +209,84 @@ void Settings::Load()
 	{
 		Reset();
 	}
+
+	auto &persistence = GetPersistence();
+	std::lock_guard<std::mutex> lock(persistence.Mutex);
+
+	for (const auto handle : persistence.Handles)
+	{
+		if (handle->Load(settings))
+		{
+			MarkDirty();
+		}
+	}
+
+	persistence.Loaded = true;
+	if (!persistence.Started)
+	{
+		persistence.Started = true;
+		std::thread(Flusher).detach();
+	}
 }
 
 void Settings::Reset() 
 {
+	auto &persistence = GetPersistence();
+	std::lock_guard<std::mutex> lock(persistence.Mutex);
+
 	settings = json::object();
-	Settings::Save();
+	MarkDirty();
 }
 
 void Settings::Save() 
 {
-	std::ofstream file(GetSettingsPath(), std::ios::out);
-	if (!file) 
+	auto &persistence = GetPersistence();
+	std::lock_guard<std::mutex> lock(persistence.Mutex);
+	MarkDirty();
+}
+
+void Settings::Flush()
+{
+	auto &persistence = GetPersistence();
+
+	std::string dump;
+
+	{
+		std::lock_guard<std::mutex> lock(persistence.Mutex);
+		if (!persistence.Dirty || persistence.Closed)
+		{
+			return;
+		}
+
+		for (const auto handle : persistence.Handles)
+		{
+			handle->Store(settings);
+		}
+
+		dump = settings.dump();
+		persistence.Dirty = false;
+	}
+
+	// Written to a temporary file first, so a crash mid-write can't leave a
+	// truncated settings file behind
+	const auto path = GetSettingsPath();
+	const auto temporaryPath = path + ".tmp";
+
+	std::ofstream file(temporaryPath, std::ios::out | std::ios::binary);
+	if (file)
 	{
-		printf("settings: failed to save %s\n", GetSettingsPath().c_str());
-		return;
+		file.write(dump.c_str(), dump.size());
+		file.close();
+
+		if (file && MoveFileExA(temporaryPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+		{
+			return;
+		}
 	}
 
-	auto dump = settings.dump();
-	file.write(dump.c_str(), dump.size());
-	file.close();
+	printf("settings: failed to save %s\n", path.c_str());
+
+	// Keep the changes pending so the flusher tries again
+	std::lock_guard<std::mutex> lock(persistence.Mutex);
+	MarkDirty();
 }
\ No newline at end of file
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
 #include "json.h"
 
 namespace Settings 
@@ -8,5 +13,130 @@ namespace Settings
     json GetSetting(const std::vector<std::string> &keys, const json &defaultValue);
     void Load();
     void Reset();
+
+    // Marks the settings as changed. They're written out shortly after by a
+    // background thread, or by Flush
     void Save();
-}
\ No newline at end of file
+
+    // Writes pending changes now, e.g. on shutdown
+    void Flush();
+
+    // Directory the settings file lives in, for other files kept next to it
+    std::string GetDirectory();
+
+    // Base of the typed Setting handles. Handles must be static, they stay
+    // registered until exit, and the flusher writes dirty ones into the store
+    class Handle
+    {
+    public:
+        Handle(std::initializer_list<std::string> keys);
+        virtual ~Handle();
+
+        Handle(const Handle &) = delete;
+        Handle &operator=(const Handle &) = delete;
+
+        // Both called with the settings lock held. Load returns true if it
+        // inserted the default value, Store only writes the value if it changed
+        virtual bool Load(json &settings) = 0;
+        virtual void Store(json &settings) = 0;
+
+    protected:
+        // Called by the derived constructor, loads the handle if the settings
+        // already were
+        void Register();
+        void MarkDirty();
+
+        json::json_pointer Pointer;
+        std::atomic<bool> Dirty{false};
+    };
+}
+
+// A setting declared once, e.g.
+//     static Setting<bool> Enabled({ "Misc", "Enabled" }, false);
+// Its key path is resolved once, reads return the cached value and writes only
+// mark it dirty, it's serialised when the settings are next flushed. Meant for
+// plain values owned by a single thread, usually the render thread.
+template <typename T>
+class Setting : public Settings::Handle
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Setting values are read by the flusher thread");
+
+public:
+    typedef void (*ChangeCallback)(const T &value);
+
+    Setting(std::initializer_list<std::string> keys, const T &defaultValue) : Handle(keys), Value(defaultValue), Default(defaultValue)
+    {
+        Register();
+    }
+
+    operator const T &() const
+    {
+        return Value;
+    }
+
+    const T &Get() const
+    {
+        return Value;
+    }
+
+    Setting &operator=(const T &value)
+    {
+        Value = value;
+        Commit();
+
+        return *this;
+    }
+
+    // For widgets that edit the value in place. Call Commit after they report
+    // a change
+    T *Data()
+    {
+        return &Value;
+    }
+
+    void Commit()
+    {
+        MarkDirty();
+
+        for (const auto callback : Callbacks)
+        {
+            callback(Value);
+        }
+    }
+
+    void OnChange(ChangeCallback callback)
+    {
+        Callbacks.push_back(callback);
+    }
+
+    bool Load(json &settings) override
+    {
+        try
+        {
+            if (settings.contains(Pointer))
+            {
+                Value = settings[Pointer].get<T>();
+                return false;
+            }
+        }
+        catch (const json::exception &) {}
+
+        Value = Default;
+        settings[Pointer] = Value;
+
+        return true;
+    }
+
+    void Store(json &settings) override
+    {
+        if (Dirty.exchange(false))
+        {
+            settings[Pointer] = Value;
+        }
+    }
+
+private:
+    T Value;
+    const T Default;
+    std::vector<ChangeCallback> Callbacks;
+};
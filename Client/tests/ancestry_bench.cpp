@@ -0,0 +1,229 @@
+// Benchmarks UObject::IsA's class ancestry table on a synthetic class hierarchy
+// against the SuperField walk it replaced, and checks both agree. The SDK only
+// builds against the game's headers with MSVC, so this mirrors the ancestry
+// cache in ME_Core_functions.cpp without its SEH guards. Linux only, built
+// outside the Visual Studio project:
+//     g++ -std=c++17 -O2 ancestry_bench.cpp -o ancestry_bench
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <vector>
+
+struct UClass {
+    int32_t ObjectInternalInteger;
+    UClass *SuperField;
+};
+
+struct UObject {
+    UClass *Class;
+};
+
+static const size_t ClassCount = 3000;
+static const size_t ObjectCount = 100000;
+static const size_t TargetCount = 16;
+static const int Runs = 5;
+
+struct FClassAncestry {
+    std::atomic<UClass *> Class;
+    int32_t Depth;
+    UClass **Ancestors;
+};
+
+static const uint32_t AncestryChunkSize = 1024;
+static const uint32_t AncestryChunkCount = 1024;
+static const int32_t AncestryMaxDepth = 64;
+
+static struct {
+    std::atomic<FClassAncestry *> Chunks[AncestryChunkCount];
+    std::mutex Mutex;
+} classAncestry;
+
+static const FClassAncestry *FindAncestry(const UClass *cls) {
+    const auto slot = static_cast<uint32_t>(cls->ObjectInternalInteger);
+    if (slot >= AncestryChunkSize * AncestryChunkCount) {
+        return nullptr;
+    }
+
+    const auto chunk =
+        classAncestry.Chunks[slot / AncestryChunkSize].load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+        return nullptr;
+    }
+
+    const auto entry = &chunk[slot % AncestryChunkSize];
+    return entry->Class.load(std::memory_order_acquire) == cls ? entry : nullptr;
+}
+
+static const FClassAncestry *CacheAncestry(UClass *cls) {
+    UClass *chain[AncestryMaxDepth];
+
+    auto length = 0;
+    for (auto super = cls; super; super = super->SuperField) {
+        if (length == AncestryMaxDepth) {
+            return nullptr;
+        }
+
+        chain[length++] = super;
+    }
+
+    std::lock_guard<std::mutex> lock(classAncestry.Mutex);
+
+    UClass **ancestors = nullptr;
+
+    for (auto depth = 0; depth < length; ++depth) {
+        const auto ancestor = chain[length - 1 - depth];
+        const auto slot = static_cast<uint32_t>(ancestor->ObjectInternalInteger);
+
+        auto chunk =
+            classAncestry.Chunks[slot / AncestryChunkSize].load(std::memory_order_relaxed);
+        if (chunk == nullptr) {
+            chunk = new FClassAncestry[AncestryChunkSize]();
+            classAncestry.Chunks[slot / AncestryChunkSize].store(chunk,
+                                                                 std::memory_order_release);
+        }
+
+        auto &entry = chunk[slot % AncestryChunkSize];
+        if (entry.Class.load(std::memory_order_relaxed) == ancestor) {
+            continue;
+        }
+
+        if (ancestors == nullptr) {
+            ancestors = new UClass *[length];
+            for (auto i = 0; i < length; ++i) {
+                ancestors[i] = chain[length - 1 - i];
+            }
+        }
+
+        entry.Class.store(nullptr, std::memory_order_relaxed);
+        entry.Depth = depth;
+        entry.Ancestors = ancestors;
+        entry.Class.store(ancestor, std::memory_order_release);
+    }
+
+    return FindAncestry(cls);
+}
+
+// The old UObject::IsA
+static bool WalkIsA(const UObject *object, UClass *cmp) {
+    for (auto super = object->Class; super; super = super->SuperField) {
+        if (super == cmp) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool IsA(const UObject *object, UClass *cmp) {
+    auto ancestry = FindAncestry(object->Class);
+    if (ancestry == nullptr && (ancestry = CacheAncestry(object->Class)) == nullptr) {
+        return WalkIsA(object, cmp);
+    }
+
+    auto target = FindAncestry(cmp);
+    if (target == nullptr && (target = CacheAncestry(cmp)) == nullptr) {
+        return WalkIsA(object, cmp);
+    }
+
+    return ancestry->Depth >= target->Depth && ancestry->Ancestors[target->Depth] == cmp;
+}
+
+template <typename Function> static double Measure(Function function) {
+    auto best = 0.0;
+
+    for (auto run = 0; run < Runs; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto elapsed = std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+
+        best = run == 0 || elapsed < best ? elapsed : best;
+    }
+
+    return best;
+}
+
+int main() {
+    std::mt19937 random(1234);
+
+    // Object at the root, then subclasses picked among the recent classes so
+    // chains run 6 to 14 deep like Object > Actor > Pawn > GamePawn > TdPawn
+    std::vector<UClass> classes(ClassCount);
+    std::vector<int> depths(ClassCount);
+    classes[0] = {0, nullptr};
+
+    for (size_t i = 1; i < ClassCount; ++i) {
+        auto parent = i < 8 ? i - 1 : random() % i;
+        while (depths[parent] > 13) {
+            parent = classes[parent].SuperField - classes.data();
+        }
+
+        // Classes are scattered through GObjects among the other objects
+        classes[i] = {static_cast<int32_t>(i * 37), &classes[parent]};
+        depths[i] = depths[parent] + 1;
+    }
+
+    std::vector<UObject> objects(ObjectCount);
+    for (auto &object : objects) {
+        object.Class = &classes[ClassCount / 2 + random() % (ClassCount / 2)];
+    }
+
+    // Classes the engine loops look for, from broad to leaf
+    UClass *targets[TargetCount];
+    for (size_t i = 0; i < TargetCount; ++i) {
+        targets[i] = &classes[i < 4 ? i + 1 : random() % ClassCount];
+    }
+
+    size_t expected = 0;
+    const auto walk = Measure([&] {
+        expected = 0;
+        for (const auto target : targets) {
+            for (const auto &object : objects) {
+                expected += WalkIsA(&object, target);
+            }
+        }
+    });
+
+    size_t found = 0;
+    const auto table = Measure([&] {
+        found = 0;
+        for (const auto target : targets) {
+            for (const auto &object : objects) {
+                found += IsA(&object, target);
+            }
+        }
+    });
+
+    auto failures = 0;
+    for (const auto target : targets) {
+        for (const auto &object : objects) {
+            if (IsA(&object, target) != WalkIsA(&object, target)) {
+                ++failures;
+            }
+        }
+    }
+
+    if (failures || found != expected) {
+        printf("%d checks disagree, %zu walk matches, %zu table matches\n", failures,
+               expected, found);
+    }
+
+    const auto checks = static_cast<double>(TargetCount * ObjectCount);
+    auto depth = 0.0;
+    for (const auto &object : objects) {
+        depth += depths[object.Class - classes.data()];
+    }
+
+    printf("%zu IsA checks, %zu classes, mean depth %.1f, best of %d runs\n",
+           TargetCount * ObjectCount, ClassCount, depth / ObjectCount, Runs);
+    printf("  SuperField walk      %8.2f ns per check\n", walk * 1e6 / checks);
+    printf("  ancestry table       %8.2f ns per check  (%.1fx)\n", table * 1e6 / checks,
+           walk / table);
+
+    return failures || found != expected ? 1 : 0;
+}
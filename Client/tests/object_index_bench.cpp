@@ -0,0 +1,125 @@
+// Benchmarks UObject::FindObject's full name index on a synthetic 100k object
+// table against the linear GetFullName scan it replaced, and checks both find
+// the same objects. Linux only, built outside the Visual Studio project:
+//     g++ -std=c++17 -O2 object_index_bench.cpp -o object_index_bench
+
+#include <chrono>
+#include <cstdio>
+
+#include "object_model.h"
+
+using namespace Model;
+
+static const size_t ObjectCount = 100000;
+static const size_t QueryCount = 200;
+static const int Runs = 5;
+
+// The index in ME_Core_functions.cpp, without its locking and rebuilds
+static std::unordered_multimap<uint64_t, uint32_t> slots;
+
+static void IndexObjects(size_t first) {
+    for (auto i = first; i < GObjects.size(); ++i) {
+        slots.emplace(FObjectPath::HashOf(GObjects[i]), static_cast<uint32_t>(i));
+    }
+}
+
+static UObject *ProbeObjectIndex(const std::string &name) {
+    const FObjectPath path(name);
+    if (!path.IsValid) {
+        return nullptr;
+    }
+
+    const auto range = slots.equal_range(path.Hash);
+
+    UObject *found = nullptr;
+    auto foundSlot = UINT32_MAX;
+
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second < foundSlot && path.Matches(GObjects[it->second])) {
+            found = GObjects[it->second];
+            foundSlot = it->second;
+        }
+    }
+
+    return found;
+}
+
+template <typename Function> static double Measure(Function function) {
+    auto best = 0.0;
+
+    for (auto run = 0; run < Runs; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto elapsed = std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+
+        best = run == 0 || elapsed < best ? elapsed : best;
+    }
+
+    return best;
+}
+
+int main() {
+    BuildObjects(ObjectCount, 1234);
+
+    // Spread over the whole table, like SDK wrappers resolving their functions
+    std::mt19937 random(5678);
+    std::vector<std::string> queries;
+    for (size_t i = 0; i < QueryCount; ++i) {
+        queries.push_back(GetFullName(GObjects[random() % GObjects.size()]));
+    }
+
+    std::vector<UObject *> expected(QueryCount);
+    const auto scan = Measure([&] {
+        for (size_t i = 0; i < QueryCount; ++i) {
+            expected[i] = ScanFullNames(queries[i]);
+        }
+    });
+
+    const auto build = Measure([] {
+        slots.clear();
+        slots.reserve(GObjects.size());
+        IndexObjects(0);
+    });
+
+    std::vector<UObject *> found(QueryCount);
+    const auto probe = Measure([&] {
+        for (size_t i = 0; i < QueryCount; ++i) {
+            found[i] = ProbeObjectIndex(queries[i]);
+        }
+    });
+
+    // Objects appended after the index was built are added on the next miss
+    const auto indexed = GObjects.size();
+    for (size_t i = 0; i < 1000; ++i) {
+        const auto copy = *GObjects[indexed - 1 - i];
+        GObjects.push_back(new UObject{copy.Outer, {copy.Name.Index, copy.Name.Number + 50},
+                                       copy.Class});
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    IndexObjects(indexed);
+    const auto append = std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+
+    auto failures = 0;
+    for (size_t i = 0; i < QueryCount; ++i) {
+        if (!expected[i] || found[i] != expected[i]) {
+            printf("query %zu (%s): scan %p, index %p\n", i, queries[i].c_str(),
+                   static_cast<void *>(expected[i]), static_cast<void *>(found[i]));
+            ++failures;
+        }
+    }
+
+    printf("%zu lookups over %zu objects, best of %d runs\n", QueryCount, ObjectCount,
+           Runs);
+    printf("  GetFullName scan         %10.2f us per lookup\n", scan * 1000 / QueryCount);
+    printf("  index probe              %10.2f us per lookup  (%.0fx)\n",
+           probe * 1000 / QueryCount, scan / probe);
+    printf("  index build, one pass    %10.2f ms\n", build);
+    printf("  index 1000 new objects   %10.2f ms\n", append);
+
+    return failures ? 1 : 0;
+}
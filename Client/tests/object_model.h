@@ -0,0 +1,334 @@
+#pragma once
+
+// A model of the SDK's object lookups for the benchmarks. The SDK only builds
+// against the game's 32-bit layout with MSVC, so this mirrors the parts the
+// lookups read: GNames entries, the Outer, Name and Class fields of UObject,
+// UObject::GetFullName as it was before the index, and FName::FindIndex and
+// FObjectPath from ME_Basic.cpp. Keep it in sync when those change.
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Model {
+
+struct FName {
+    int32_t Index;
+    int32_t Number;
+};
+
+struct UObject {
+    UObject *Outer;
+    FName Name;
+    UObject *Class;
+};
+
+inline std::vector<std::wstring> GNames;
+inline std::vector<UObject *> GObjects;
+
+static const uint64_t FNVOffset = 14695981039346656037ull;
+static const uint64_t FNVPrime = 1099511628211ull;
+
+inline uint64_t HashChar(uint64_t hash, char c) {
+    return (hash ^ static_cast<unsigned char>(c)) * FNVPrime;
+}
+
+inline char NarrowChar(wchar_t c) { return c < 0x80 ? static_cast<char>(c) : '?'; }
+
+// FNameEntry::GetName and FName::GetName
+inline std::string GetName(const FName &name) {
+    const auto &wide = GNames[name.Index];
+
+    std::string str(wide.size(), '\0');
+    for (size_t i = 0; i < wide.size(); ++i) {
+        str[i] = NarrowChar(wide[i]);
+    }
+
+    if (name.Number > 0) {
+        str += "_" + std::to_string(name.Number - 1);
+    }
+
+    return str;
+}
+
+// UObject::GetFullName, which the lookups used to build for every object
+inline std::string GetFullName(const UObject *object) {
+    std::string name;
+
+    if (object->Class != nullptr) {
+        std::string temp;
+        for (auto p = object->Outer; p; p = p->Outer) {
+            temp = GetName(p->Name) + "." + temp;
+        }
+
+        name = GetName(object->Class->Name);
+        name += " ";
+        name += temp;
+        name += GetName(object->Name);
+    }
+
+    return name;
+}
+
+// The old UObject::FindObject
+inline UObject *ScanFullNames(const std::string &name) {
+    for (const auto object : GObjects) {
+        if (object != nullptr && GetFullName(object) == name) {
+            return object;
+        }
+    }
+
+    return nullptr;
+}
+
+inline std::unordered_multimap<uint64_t, int32_t> NameIndex;
+
+inline void IndexNames() {
+    NameIndex.clear();
+
+    for (size_t i = 0; i < GNames.size(); ++i) {
+        auto hash = FNVOffset;
+        for (const auto c : GNames[i]) {
+            hash = HashChar(hash, NarrowChar(c));
+        }
+
+        NameIndex.emplace(hash, static_cast<int32_t>(i));
+    }
+}
+
+inline bool FindIndex(const char *name, size_t length, int32_t &index) {
+    auto hash = FNVOffset;
+    for (size_t i = 0; i < length; ++i) {
+        hash = HashChar(hash, name[i]);
+    }
+
+    const auto range = NameIndex.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        const auto &entry = GNames[it->second];
+
+        size_t i = 0;
+        while (i < length && i < entry.size() &&
+               entry[i] == static_cast<wchar_t>(static_cast<unsigned char>(name[i]))) {
+            ++i;
+        }
+
+        if (i == length && entry.size() == length) {
+            index = it->second;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline uint64_t HashName(uint64_t hash, const FName &name) {
+    for (const auto c : GNames[name.Index]) {
+        hash = HashChar(hash, NarrowChar(c));
+    }
+
+    if (name.Number > 0) {
+        char digits[16];
+        auto count = 0;
+
+        for (auto number = static_cast<uint32_t>(name.Number - 1); count == 0 || number;
+             number /= 10) {
+            digits[count++] = '0' + number % 10;
+        }
+
+        hash = HashChar(hash, '_');
+        while (count) {
+            hash = HashChar(hash, digits[--count]);
+        }
+    }
+
+    return hash;
+}
+
+struct FObjectPath {
+    static const int32_t MaxDepth = 16;
+
+    struct FPart {
+        int32_t Index;
+        int32_t BaseIndex;
+        int32_t BaseNumber;
+
+        bool Matches(const FName &name) const {
+            return (name.Number == 0 && name.Index == Index) ||
+                   (name.Index == BaseIndex && name.Number == BaseNumber);
+        }
+    };
+
+    FPart Class;
+    FPart Parts[MaxDepth];
+    int32_t Depth = 0;
+    uint64_t Hash = FNVOffset;
+    bool IsValid = false;
+
+    static bool ParsePart(const char *text, size_t length, FPart &part) {
+        part.Index = part.BaseIndex = -1;
+        part.BaseNumber = 0;
+
+        FindIndex(text, length, part.Index);
+
+        auto digits = length;
+        while (digits > 0 && text[digits - 1] >= '0' && text[digits - 1] <= '9') {
+            --digits;
+        }
+
+        if (digits > 1 && digits < length && text[digits - 1] == '_' &&
+            (text[digits] != '0' || digits + 1 == length) && length - digits < 10) {
+
+            int32_t number = 0;
+            for (auto i = digits; i < length; ++i) {
+                number = number * 10 + (text[i] - '0');
+            }
+
+            if (FindIndex(text, digits - 1, part.BaseIndex)) {
+                part.BaseNumber = number + 1;
+            }
+        }
+
+        return part.Index != -1 || part.BaseIndex != -1;
+    }
+
+    explicit FObjectPath(const std::string &fullName) {
+        for (const auto c : fullName) {
+            Hash = HashChar(Hash, c);
+        }
+
+        const auto space = fullName.find(' ');
+        if (space == std::string::npos || !ParsePart(fullName.c_str(), space, Class)) {
+            return;
+        }
+
+        for (auto begin = space + 1;;) {
+            auto end = fullName.find('.', begin);
+            if (end == std::string::npos) {
+                end = fullName.size();
+            }
+
+            if (Depth == MaxDepth ||
+                !ParsePart(fullName.c_str() + begin, end - begin, Parts[Depth])) {
+                return;
+            }
+
+            ++Depth;
+
+            if (end == fullName.size()) {
+                break;
+            }
+
+            begin = end + 1;
+        }
+
+        IsValid = true;
+    }
+
+    bool Matches(const UObject *object) const {
+        if (!IsValid || object->Class == nullptr || !Class.Matches(object->Class->Name)) {
+            return false;
+        }
+
+        auto p = object;
+        for (auto i = Depth - 1; i >= 0; --i, p = p->Outer) {
+            if (p == nullptr || !Parts[i].Matches(p->Name)) {
+                return false;
+            }
+        }
+
+        return p == nullptr;
+    }
+
+    static uint64_t HashOf(const UObject *object) {
+        if (object->Class == nullptr) {
+            return 0;
+        }
+
+        const UObject *chain[MaxDepth];
+        auto depth = 0;
+
+        for (auto p = object; p; p = p->Outer) {
+            if (depth == MaxDepth) {
+                return 0;
+            }
+
+            chain[depth++] = p;
+        }
+
+        auto hash = HashChar(HashName(FNVOffset, object->Class->Name), ' ');
+
+        while (depth > 0) {
+            hash = HashName(hash, chain[--depth]->Name);
+
+            if (depth > 0) {
+                hash = HashChar(hash, '.');
+            }
+        }
+
+        return hash;
+    }
+};
+
+// Fills GNames and GObjects with a package, group and object hierarchy shaped
+// like the game's: a few hundred packages and classes, objects two or three
+// levels deep and many names that only differ by their instance number
+inline void BuildObjects(size_t count, unsigned int seed) {
+    std::mt19937 random(seed);
+
+    GNames.clear();
+    GObjects.clear();
+
+    static const wchar_t *words[] = {L"Td",     L"Mesh",   L"Sound", L"Anim",  L"Light",
+                                     L"Volume", L"Static", L"Actor", L"Pawn",  L"Seq",
+                                     L"Cue",    L"Node",   L"Decal", L"Brush", L"Model"};
+
+    const auto wordCount = sizeof(words) / sizeof(*words);
+    for (size_t i = 0; i < 6000; ++i) {
+        GNames.push_back(std::wstring(words[i % wordCount]) +
+                         words[(i / wordCount) % wordCount] + std::to_wstring(i));
+    }
+
+    const auto nameOf = [&](size_t limit) {
+        return FName{static_cast<int32_t>(random() % limit),
+                     random() % 3 ? 0 : static_cast<int32_t>(random() % 40)};
+    };
+
+    const auto add = [](UObject *outer, FName name, UObject *cls) {
+        GObjects.push_back(new UObject{outer, name, cls});
+        return GObjects.back();
+    };
+
+    GNames.push_back(L"Class");
+    const auto metaclass = add(nullptr, FName{static_cast<int32_t>(GNames.size() - 1), 0},
+                               nullptr);
+    metaclass->Class = metaclass;
+
+    std::vector<UObject *> packages;
+    for (auto i = 0; i < 300; ++i) {
+        packages.push_back(add(nullptr, nameOf(GNames.size()), metaclass));
+    }
+
+    std::vector<UObject *> classes;
+    for (auto i = 0; i < 500; ++i) {
+        classes.push_back(add(packages[random() % 30], nameOf(GNames.size()), metaclass));
+    }
+
+    std::vector<UObject *> groups;
+    for (auto i = 0; i < 3000; ++i) {
+        groups.push_back(add(packages[random() % packages.size()], nameOf(GNames.size()),
+                             classes[random() % classes.size()]));
+    }
+
+    while (GObjects.size() < count) {
+        const auto outer = random() % 4 ? groups[random() % groups.size()]
+                                        : packages[random() % packages.size()];
+
+        add(outer, nameOf(GNames.size()), classes[random() % classes.size()]);
+    }
+
+    IndexNames();
+}
+
+} // namespace Model
@@ -0,0 +1,119 @@
+// Benchmarks matching objects against a full name with FObjectPath, which
+// walks the Outer chain comparing name indices, against building and comparing
+// GetFullName strings. Both scan the whole synthetic table without the index,
+// and the heap allocations of each are counted. Linux only, built outside the
+// Visual Studio project:
+//     g++ -std=c++17 -O2 path_match_bench.cpp -o path_match_bench
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "object_model.h"
+
+using namespace Model;
+
+static const size_t ObjectCount = 100000;
+static const size_t QueryCount = 20;
+static const int Runs = 3;
+
+// Counts every heap allocation. GCC takes the replaced operators below for a
+// mismatched new and free once they're inlined
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+static size_t allocations = 0;
+
+void *operator new(size_t size) {
+    ++allocations;
+
+    if (const auto memory = malloc(size ? size : 1)) {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept { free(memory); }
+void operator delete(void *memory, size_t) noexcept { free(memory); }
+
+struct Result {
+    double Milliseconds;
+    size_t Allocations;
+};
+
+template <typename Function> static Result Measure(Function function) {
+    Result best = {0, 0};
+
+    for (auto run = 0; run < Runs; ++run) {
+        const auto before = allocations;
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto elapsed = std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+
+        if (run == 0 || elapsed < best.Milliseconds) {
+            best = {elapsed, allocations - before};
+        }
+    }
+
+    return best;
+}
+
+int main() {
+    BuildObjects(ObjectCount, 1234);
+
+    std::mt19937 random(5678);
+    std::vector<std::string> queries;
+    for (size_t i = 0; i < QueryCount; ++i) {
+        queries.push_back(GetFullName(GObjects[random() % GObjects.size()]));
+    }
+
+    // Both count every match so they compare the whole table
+    std::vector<size_t> expected(QueryCount);
+    const auto strings = Measure([&] {
+        for (size_t i = 0; i < QueryCount; ++i) {
+            expected[i] = 0;
+
+            for (const auto object : GObjects) {
+                expected[i] += GetFullName(object) == queries[i];
+            }
+        }
+    });
+
+    std::vector<size_t> found(QueryCount);
+    const auto paths = Measure([&] {
+        for (size_t i = 0; i < QueryCount; ++i) {
+            const FObjectPath path(queries[i]);
+            found[i] = 0;
+
+            for (const auto object : GObjects) {
+                found[i] += path.Matches(object);
+            }
+        }
+    });
+
+    auto failures = 0;
+    for (size_t i = 0; i < QueryCount; ++i) {
+        if (!expected[i] || found[i] != expected[i]) {
+            printf("query %zu (%s): %zu string matches, %zu path matches\n", i,
+                   queries[i].c_str(), expected[i], found[i]);
+            ++failures;
+        }
+    }
+
+    const auto compared = static_cast<double>(QueryCount * GObjects.size());
+
+    printf("%zu full scans of %zu objects, best of %d runs\n", QueryCount, ObjectCount,
+           Runs);
+    printf("  GetFullName compare  %8.2f ns per object, %6.2f allocations per object\n",
+           strings.Milliseconds * 1e6 / compared, strings.Allocations / compared);
+    printf("  FObjectPath match    %8.2f ns per object, %6.2f allocations per object  (%.0fx)\n",
+           paths.Milliseconds * 1e6 / compared, paths.Allocations / compared,
+           strings.Milliseconds / paths.Milliseconds);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,153 @@
+// Benchmarks the signature scanner on a synthetic 30 MB image against the
+// scalar scan it replaced, and checks both find the same offsets. Linux only,
+// built outside the Visual Studio project:
+//     g++ -std=c++17 -O2 -I.. pattern_bench.cpp ../scanner.cpp -o pattern_bench
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "scanner.h"
+
+static const int ImageSize = 30 * 1024 * 1024;
+static const int Runs = 5;
+
+// The engine's signatures, see Engine::Initialize
+static Pattern::Signature signatures[] = {
+    {"\x8B\x0D\x00\x00\x00\x00\x8B\x84\x24\x00"
+     "\x00\x00\x00\x8B\x04\x81",
+     "xx????xxx????xxx"},
+    {"\x8B\x15\x00\x00\x00\x00\x8B\x0C\xB2\x8D\x44\x24\x30", "xx????xxxxxxx"},
+    {"\x56\x8B\xF1\x8B\x0D\x00\x00\x00\x00\x85\xC9\x74\x09", "xxxxx????xxxx"},
+    {"\x6A\xFF\x68\x00\x00\x00\x00\x64\xA1\x00\x00\x00\x00\x50\x81\xEC"
+     "\x00\x00\x00\x00\x53\x55\x56\x57\xA1\x00\x00\x00\x00\x33\xC4\x50"
+     "\x8D\x84\x24\x00\x00\x00\x00\x64\xA3\x00\x00\x00\x00\x8B\xE9\x89"
+     "\x6C\x24\x00\x00\xFF\x89",
+     "???????xxxxxxxxx?xxxxxxxx????xxxxxx?xxxxxxxxxxxxxx??xx"},
+    {"\x8D\x4C\x24\x10\xE8\x00\x00\x00\x00\x8B\x4C\x24\x14\x85\xC9\x7C"
+     "\x1E\x3B\xCF\x0F\x8D\x00\x00\x00\x00\x8B\x04\x8E\x8B\x40\x08\x25"
+     "\x00\x00\x00\x00\x33\xD2\x0B\xC2\x75\xD6\xE9\x00\x00\x00\x00",
+     "xxxxx????xxxxxxxxxxxx????xxxxxxx????xxxxxxx????"},
+    {"\x55\x8B\xEC\x83\xE4\xF0\x83\xEC\x38\x56\x57\x8B\x81", "xxxxxxxxxxxxx"},
+    {"\xE8\x00\x00\x00\x00\x8B\x74\x24\x14\x8D\x7B\x68", "x????xxxxxxx"},
+    {"\x83\xEC\x3C\xD9\x44\x24\x44", "xxxxxxx"},
+    {"\x83\xEC\x48\x53\x55\x56\x57\x8B\xF9\xE8\x00\x00\x00\x00\x8B\x0D"
+     "\x00\x00\x00\x00\x8B\x15\x00\x00\x00\x00\x8B\xE8",
+     "xxxxxxxxxx????xx????xx????xx"},
+};
+
+static const size_t SignatureCount = sizeof(signatures) / sizeof(*signatures);
+
+// Random bytes skewed towards the opcodes and operands common in x86 code, so
+// anchors see a realistic number of candidates
+static std::vector<unsigned char> MakeImage() {
+    static const unsigned char common[] = {
+        0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xCC, 0x8B, 0x8B, 0x89, 0x24,
+        0x44, 0x0F, 0x83, 0xE8, 0x8D, 0x04, 0x08, 0x01, 0x85, 0x74, 0x75,
+        0x0C, 0x10, 0x14, 0x50, 0x51, 0x53, 0x55, 0x56, 0x57, 0x5E, 0x5F,
+        0x6A, 0xC3, 0xC4, 0xEC,
+    };
+
+    std::mt19937 random(1234);
+    std::vector<unsigned char> image(ImageSize);
+
+    for (auto &byte : image) {
+        const auto roll = random();
+        byte = roll % 2 ? common[(roll >> 1) % sizeof(common)]
+                        : static_cast<unsigned char>(roll >> 8);
+    }
+
+    // Planted in the last few megabytes so every scan covers most of the
+    // image, like signatures deep in the game's code section
+    for (size_t i = 0; i < SignatureCount; ++i) {
+        const auto offset = ImageSize - (1 + static_cast<int>(i)) * 300001;
+        const auto length = strlen(signatures[i].Mask);
+
+        for (size_t j = 0; j < length; ++j) {
+            if (signatures[i].Mask[j] == 'x') {
+                image[offset + j] = signatures[i].Pattern[j];
+            }
+        }
+    }
+
+    return image;
+}
+
+// The scanner before it was vectorized, one CheckMask per offset
+static void *ScalarFindPattern(void *base, int size, const char *pattern,
+                               const char *mask) {
+    size -= static_cast<int>(strlen(mask));
+
+    for (int i = 0; i <= size; ++i) {
+        auto addr = reinterpret_cast<char *>(base) + i;
+        if (Pattern::CheckMask(addr, pattern, mask)) {
+            return addr;
+        }
+    }
+
+    return nullptr;
+}
+
+template <typename Function> static double Measure(Function function) {
+    auto best = 0.0;
+
+    for (auto run = 0; run < Runs; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto elapsed = std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+
+        best = run == 0 || elapsed < best ? elapsed : best;
+    }
+
+    return best;
+}
+
+int main() {
+    auto image = MakeImage();
+    const auto base = image.data();
+
+    void *expected[SignatureCount];
+    const auto scalar = Measure([&] {
+        for (size_t i = 0; i < SignatureCount; ++i) {
+            expected[i] = ScalarFindPattern(base, ImageSize, signatures[i].Pattern,
+                                            signatures[i].Mask);
+        }
+    });
+
+    void *single[SignatureCount];
+    const auto vector = Measure([&] {
+        for (size_t i = 0; i < SignatureCount; ++i) {
+            single[i] = Pattern::FindPattern(base, ImageSize, signatures[i].Pattern,
+                                             signatures[i].Mask);
+        }
+    });
+
+    const auto batched = Measure([&] {
+        Pattern::FindPatterns(base, ImageSize, signatures, SignatureCount);
+    });
+
+    auto failures = 0;
+    for (size_t i = 0; i < SignatureCount; ++i) {
+        if (!expected[i] || single[i] != expected[i] ||
+            signatures[i].Result != expected[i]) {
+
+            printf("signature %zu: scalar %p, FindPattern %p, FindPatterns %p\n",
+                   i, expected[i], single[i], signatures[i].Result);
+            ++failures;
+        }
+    }
+
+    printf("%zu signatures over %d MB, best of %d runs\n", SignatureCount,
+           ImageSize / (1024 * 1024), Runs);
+    printf("  scalar FindPattern each  %8.2f ms\n", scalar);
+    printf("  FindPattern each         %8.2f ms  (%.1fx)\n", vector,
+           scalar / vector);
+    printf("  FindPatterns batched     %8.2f ms  (%.1fx)\n", batched,
+           scalar / batched);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,257 @@
+// Benchmarks applying the bone name retargeting tables against the hard-coded
+// copies Engine::TransformBones used before, and checks both write the same
+// pose. Targets are synthetic skeletons named so that matching by name gives
+// the old copies. Mirrors BuildRetargetTable and TransformBones in engine.cpp,
+// which only build against the game's headers with MSVC. Linux only, built
+// outside the Visual Studio project:
+//     g++ -std=c++17 -O2 retarget_bench.cpp -o retarget_bench
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define PLAYER_PAWN_BONE_COUNT (108)
+
+// Same size and alignment as Classes::FBoneAtom
+struct FBoneAtom {
+    float Rotation[4];
+    float Translation[3];
+    float Scale;
+};
+
+enum class Character {
+    Faith,
+    Kate,
+    Celeste,
+    AssaultCeleste,
+    Jacknife,
+    Miller,
+    Kreeg,
+    PursuitCop,
+    Ghost,
+    Max
+};
+
+static const char *Characters[] = {
+    "Faith",
+    "Kate",
+    "Celeste",
+    "Assault Celeste",
+    "Jacknife",
+    "Miller",
+    "Kreeg",
+    "Pursuit Cop",
+    "Ghost"
+};
+
+static const int Runs = 5;
+static const int Iterations = 200000;
+
+// The old Engine::TransformBones
+static void SwitchTransformBones(Character character, FBoneAtom *dest, size_t destCount,
+                                 const FBoneAtom *src) {
+    switch (character) {
+    case Character::Faith:
+    case Character::Ghost:
+        memcpy(dest, src, PLAYER_PAWN_BONE_COUNT * sizeof(FBoneAtom));
+        break;
+    case Character::Kate:
+        memcpy(dest, src, 7 * sizeof(FBoneAtom));
+        memcpy(dest + 14, src + 14, 10 * sizeof(FBoneAtom));
+        memcpy(dest + 33, src + 39, sizeof(FBoneAtom));
+        memcpy(dest + 36, src + 42, sizeof(FBoneAtom));
+        memcpy(dest + 39, src + 45, 63 * sizeof(FBoneAtom));
+        break;
+    case Character::AssaultCeleste:
+        memcpy(dest, src, 7 * sizeof(FBoneAtom));
+        memcpy(dest + destCount - 63, src + 45, 63 * sizeof(FBoneAtom));
+        memcpy(dest + 17, src + 18, sizeof(FBoneAtom));
+        break;
+    case Character::PursuitCop:
+        memcpy(dest, src, 7 * sizeof(FBoneAtom));
+        memcpy(dest + destCount - 63, src + 45, 63 * sizeof(FBoneAtom));
+        memcpy(dest + 15, src + 18, sizeof(FBoneAtom));
+        break;
+    case Character::Miller:
+    case Character::Celeste:
+    case Character::Jacknife:
+    case Character::Kreeg:
+        memcpy(dest, src, 7 * sizeof(FBoneAtom));
+        memcpy(dest + destCount - 63, src + 45, 63 * sizeof(FBoneAtom));
+        memcpy(dest + 18, src + 18, sizeof(FBoneAtom));
+        break;
+    default:
+        break;
+    }
+}
+
+struct BoneRun {
+    unsigned short Dest;
+    unsigned short Source;
+    unsigned short Count;
+};
+
+struct RetargetTable {
+    size_t BoneCount = 0;
+    std::vector<BoneRun> Runs;
+};
+
+static bool IsRetargetSkipped(Character character, size_t bone) {
+    switch (character) {
+    case Character::Faith:
+    case Character::Ghost:
+        return false;
+    case Character::Kate:
+        return (bone >= 7 && bone < 14) || (bone >= 24 && bone < 45 && bone != 39 && bone != 42);
+    default:
+        return bone >= 7 && bone < 45 && bone != 18;
+    }
+}
+
+static RetargetTable BuildRetargetTable(Character character,
+                                        const std::vector<std::string> &sourceNames,
+                                        const std::vector<std::string> &targetNames) {
+    RetargetTable table;
+    table.BoneCount = targetNames.size();
+
+    for (size_t dest = 0; dest < targetNames.size(); ++dest) {
+        for (size_t src = 0; src < sourceNames.size(); ++src) {
+            if (sourceNames[src] != targetNames[dest]) {
+                continue;
+            }
+
+            if (IsRetargetSkipped(character, src)) {
+                break;
+            }
+
+            auto *run = table.Runs.empty() ? nullptr : &table.Runs.back();
+            if (run && run->Dest + run->Count == dest && run->Source + run->Count == src) {
+                ++run->Count;
+            } else {
+                table.Runs.push_back({static_cast<unsigned short>(dest),
+                                      static_cast<unsigned short>(src), 1});
+            }
+
+            break;
+        }
+    }
+
+    return table;
+}
+
+static void TransformBones(const RetargetTable &table, FBoneAtom *dest, size_t destCount,
+                           const FBoneAtom *src) {
+    if (destCount != table.BoneCount) {
+        return;
+    }
+
+    for (const auto &run : table.Runs) {
+        memcpy(dest + run.Dest, src + run.Source, run.Count * sizeof(FBoneAtom));
+    }
+}
+
+// A target skeleton whose names match the player's where the old copies put
+// them, every other bone has a name of its own
+static std::vector<std::string> MakeTargetNames(Character character, size_t count,
+                                                const std::vector<std::string> &source) {
+    std::vector<std::string> names(count);
+    for (size_t i = 0; i < count; ++i) {
+        names[i] = std::string(Characters[static_cast<int>(character)]) + "Bone" +
+                   std::to_string(i);
+    }
+
+    // Mark each bone the old copies wrote through a pose of source indices
+    std::vector<FBoneAtom> src(PLAYER_PAWN_BONE_COUNT);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i].Scale = static_cast<float>(i);
+    }
+
+    std::vector<FBoneAtom> dest(count);
+    for (auto &bone : dest) {
+        bone.Scale = -1;
+    }
+
+    SwitchTransformBones(character, dest.data(), count, src.data());
+
+    for (size_t i = 0; i < count; ++i) {
+        if (dest[i].Scale >= 0) {
+            names[i] = source[static_cast<size_t>(dest[i].Scale)];
+        }
+    }
+
+    return names;
+}
+
+template <typename Function> static double Measure(Function function) {
+    auto best = 0.0;
+
+    for (auto run = 0; run < Runs; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto elapsed = std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+
+        best = run == 0 || elapsed < best ? elapsed : best;
+    }
+
+    return best;
+}
+
+int main() {
+    std::vector<std::string> sourceNames;
+    for (auto i = 0; i < PLAYER_PAWN_BONE_COUNT; ++i) {
+        sourceNames.push_back("Bone" + std::to_string(i));
+    }
+
+    std::vector<FBoneAtom> src(PLAYER_PAWN_BONE_COUNT);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = {{1, 2, 3, static_cast<float>(i)}, {4, 5, 6}, 1};
+    }
+
+    // Skeleton sizes are only known from the game's meshes, these keep every
+    // old copy within bounds
+    static const size_t boneCounts[] = {108, 102, 90, 100, 90, 90, 90, 95, 108};
+
+    printf("%d transforms per character, best of %d runs\n", Iterations, Runs);
+    printf("  %-16s %6s %12s %12s\n", "character", "runs", "switch ns", "table ns");
+
+    auto failures = 0;
+    for (auto c = 0; c < static_cast<int>(Character::Max); ++c) {
+        const auto character = static_cast<Character>(c);
+        const auto count = boneCounts[c];
+        const auto table =
+            BuildRetargetTable(character, sourceNames, MakeTargetNames(character, count, sourceNames));
+
+        std::vector<FBoneAtom> expected(count), dest(count);
+        SwitchTransformBones(character, expected.data(), count, src.data());
+        TransformBones(table, dest.data(), count, src.data());
+
+        if (memcmp(expected.data(), dest.data(), count * sizeof(FBoneAtom))) {
+            printf("%s: the table and the switch wrote different poses\n", Characters[c]);
+            ++failures;
+        }
+
+        // Through a volatile pointer, so the copies aren't hoisted out of the loop
+        const auto sink = static_cast<FBoneAtom *volatile>(dest.data());
+
+        const auto switched = Measure([&] {
+            for (auto i = 0; i < Iterations; ++i) {
+                SwitchTransformBones(character, sink, count, src.data());
+            }
+        });
+
+        const auto tabled = Measure([&] {
+            for (auto i = 0; i < Iterations; ++i) {
+                TransformBones(table, sink, count, src.data());
+            }
+        });
+
+        printf("  %-16s %6zu %12.2f %12.2f\n", Characters[c], table.Runs.size(),
+               switched * 1e6 / Iterations, tabled * 1e6 / Iterations);
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,163 @@
+// Tests the portable trampoline pool against mmap'd executable blocks. Linux
+// only, built outside the Visual Studio project:
+//     g++ -std=c++17 -O2 -I.. trampoline_test.cpp ../trampoline.cpp -o trampoline_test -pthread
+
+#include <sys/mman.h>
+
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "trampoline.h"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                       \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__,            \
+                   #condition);                                                \
+            ++failures;                                                        \
+        }                                                                      \
+    } while (0)
+
+static size_t blocks = 0;
+
+static void *AllocateBlock(size_t size) {
+    const auto block = mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (block == MAP_FAILED) {
+        return nullptr;
+    }
+
+    ++blocks;
+    return block;
+}
+
+static void *FailBlock(size_t) { return nullptr; }
+
+// mov eax, value; ret
+static int (*WriteReturn(void *slot, int value))() {
+    const auto code = static_cast<unsigned char *>(slot);
+    code[0] = 0xB8;
+    memcpy(code + 1, &value, sizeof(value));
+    code[5] = 0xC3;
+
+    return reinterpret_cast<int (*)()>(slot);
+}
+
+static void TestSlotsAreDistinctAndRunnable() {
+    Hook::TrampolinePool pool(32, 4096, AllocateBlock);
+
+    std::vector<int (*)()> functions;
+    std::set<unsigned char *> slots;
+
+    for (auto i = 0; i < 100; ++i) {
+        const auto slot = static_cast<unsigned char *>(pool.Allocate(6));
+        CHECK(slot != nullptr);
+        CHECK(reinterpret_cast<uintptr_t>(slot) % 32 == 0);
+
+        for (const auto other : slots) {
+            CHECK(slot + 32 <= other || other + 32 <= slot);
+        }
+
+        slots.insert(slot);
+        functions.push_back(WriteReturn(slot, i));
+    }
+
+    for (auto i = 0; i < 100; ++i) {
+        CHECK(functions[i]() == i);
+    }
+
+    CHECK(pool.GetAllocated() == 100);
+}
+
+static void TestBlocksAreShared() {
+    blocks = 0;
+    Hook::TrampolinePool pool(32, 4096, AllocateBlock);
+
+    for (auto i = 0; i < 4096 / 32; ++i) {
+        CHECK(pool.Allocate(32) != nullptr);
+    }
+
+    CHECK(blocks == 1);
+    CHECK(pool.Allocate(32) != nullptr);
+    CHECK(blocks == 2);
+}
+
+static void TestOversizedAndFailedAllocations() {
+    Hook::TrampolinePool pool(32, 4096, AllocateBlock);
+    CHECK(pool.Allocate(33) == nullptr);
+
+    Hook::TrampolinePool failing(32, 4096, FailBlock);
+    CHECK(failing.Allocate(8) == nullptr);
+    CHECK(failing.GetAllocated() == 0);
+}
+
+// A thread may still be inside a removed hook's trampoline, so freeing must
+// neither clobber the code nor hand the slot out again
+static void TestFreedSlotsKeepTheirCode() {
+    Hook::TrampolinePool pool(32, 4096, AllocateBlock);
+
+    const auto slot = pool.Allocate(6);
+    const auto function = WriteReturn(slot, 42);
+    pool.Free(slot);
+
+    CHECK(function() == 42);
+    CHECK(pool.GetRetired() == 1);
+
+    for (auto i = 0; i < 1000; ++i) {
+        CHECK(pool.Allocate(6) != slot);
+    }
+
+    CHECK(function() == 42);
+}
+
+static void TestConcurrentAllocations() {
+    Hook::TrampolinePool pool(32, 4096, AllocateBlock);
+
+    const auto threadCount = 4;
+    const auto perThread = 500;
+    std::vector<void *> slots[threadCount];
+    std::vector<std::thread> threads;
+
+    for (auto t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&pool, &slots, t] {
+            for (auto i = 0; i < perThread; ++i) {
+                slots[t].push_back(pool.Allocate(16));
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    std::set<void *> unique;
+    for (const auto &list : slots) {
+        for (const auto slot : list) {
+            CHECK(slot != nullptr);
+            unique.insert(slot);
+        }
+    }
+
+    CHECK(unique.size() == threadCount * perThread);
+}
+
+int main() {
+    TestSlotsAreDistinctAndRunnable();
+    TestBlocksAreShared();
+    TestOversizedAndFailedAllocations();
+    TestFreedSlotsKeepTheirCode();
+    TestConcurrentAllocations();
+
+    if (failures) {
+        printf("trampoline_test: %d failures\n", failures);
+        return 1;
+    }
+
+    printf("trampoline_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include <windows.h>
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+#include "trace.h"
+
+static const unsigned int EventCapacity = 0x4000;
+static const size_t MaxThreads = 64;
+
+struct EventData {
+    const char *Name;
+    long long Start;
+    long long Duration;
+    char Phase;
+};
+
+// Sequence is the event's index + 1 once written, and 0 while the slot is
+// being overwritten. Flush compares it before and after copying the data, so
+// it skips events their thread overwrote meanwhile instead of mixing two
+struct TraceEvent {
+    std::atomic<unsigned int> Sequence{0};
+    EventData Data;
+};
+
+// Written only by its thread. Flush reads up to the published head, so no
+// locks are taken while recording
+struct ThreadBuffer {
+    DWORD ThreadId = 0;
+    const char *Name = nullptr;
+    std::atomic<unsigned int> Head{0};
+    unsigned int Flushed = 0;
+    TraceEvent Events[EventCapacity];
+};
+
+bool Trace::Enabled = false;
+
+static struct {
+    std::vector<ThreadBuffer *> Buffers;
+    std::mutex Mutex;
+} trace;
+
+static thread_local ThreadBuffer *threadBuffer = nullptr;
+static thread_local const char *threadName = nullptr;
+
+static ThreadBuffer *GetThreadBuffer() {
+    if (threadBuffer) {
+        return threadBuffer;
+    }
+
+    std::lock_guard<std::mutex> lock(trace.Mutex);
+    if (trace.Buffers.size() == MaxThreads) {
+        return nullptr;
+    }
+
+    // Kept after the thread exits so its events can still be flushed
+    threadBuffer = new ThreadBuffer();
+    threadBuffer->ThreadId = GetCurrentThreadId();
+    threadBuffer->Name = threadName;
+
+    trace.Buffers.push_back(threadBuffer);
+    return threadBuffer;
+}
+
+static void Record(const char *name, long long start, long long duration,
+                   char phase) {
+
+    const auto buffer = GetThreadBuffer();
+    if (!buffer) {
+        return;
+    }
+
+    const auto head = buffer->Head.load(std::memory_order_relaxed);
+    auto &event = buffer->Events[head % EventCapacity];
+
+    event.Sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    event.Data = {name, start, duration, phase};
+
+    event.Sequence.store(head + 1, std::memory_order_release);
+    buffer->Head.store(head + 1, std::memory_order_release);
+}
+
+void Trace::Complete(const char *name, long long start) {
+    Record(name, start, Profiler::Now() - start, 'X');
+}
+
+void Trace::Instant(const char *name) {
+    if (Enabled) {
+        Record(name, Profiler::Now(), 0, 'i');
+    }
+}
+
+void Trace::NameThread(const char *name) {
+    threadName = name;
+
+    if (threadBuffer) {
+        threadBuffer->Name = name;
+    }
+}
+
+bool Trace::Flush(const std::string &path) {
+    LARGE_INTEGER frequency;
+    if (!QueryPerformanceFrequency(&frequency)) {
+        return false;
+    }
+
+    FILE *file = nullptr;
+    if (fopen_s(&file, path.c_str(), "w") || !file) {
+        printf("trace: failed to open %s\n", path.c_str());
+        return false;
+    }
+
+    const auto microseconds = 1000000.0 / frequency.QuadPart;
+    const auto pid = GetCurrentProcessId();
+    auto separator = "";
+
+    fprintf(file, "{\"traceEvents\":[\n");
+
+    std::lock_guard<std::mutex> lock(trace.Mutex);
+
+    for (const auto buffer : trace.Buffers) {
+        if (buffer->Name) {
+            fprintf(file,
+                    "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%lu,"
+                    "\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+                    separator, pid, buffer->ThreadId, buffer->Name);
+
+            separator = ",\n";
+        }
+
+        // Events older than one buffer length were already overwritten
+        const auto head = buffer->Head.load(std::memory_order_acquire);
+        auto i = head - buffer->Flushed > EventCapacity ? head - EventCapacity
+                                                        : buffer->Flushed;
+
+        for (; i != head; ++i) {
+            const auto &slot = buffer->Events[i % EventCapacity];
+
+            const auto sequence = slot.Sequence.load(std::memory_order_acquire);
+            if (sequence != i + 1) {
+                continue;
+            }
+
+            const auto event = slot.Data;
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.Sequence.load(std::memory_order_relaxed) != sequence) {
+                continue;
+            }
+
+            fprintf(file,
+                    "%s{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":%lu,\"tid\":%lu,"
+                    "\"ts\":%.3f",
+                    separator, event.Name, event.Phase, pid, buffer->ThreadId,
+                    event.Start * microseconds);
+
+            if (event.Phase == 'X') {
+                fprintf(file, ",\"dur\":%.3f}", event.Duration * microseconds);
+            } else {
+                fprintf(file, ",\"s\":\"t\"}");
+            }
+
+            separator = ",\n";
+        }
+
+        buffer->Flushed = head;
+    }
+
+    fprintf(file, "\n]}\n");
+    fclose(file);
+
+    return true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+
+#include "profiler.h"
+
+namespace Trace {
+
+// Checked once per span or event, so a disabled tracer costs a single branch
+extern bool Enabled;
+
+// Records a span from start (Profiler::Now) until now on the calling thread
+void Complete(const char *name, long long start);
+
+// Records a point-in-time event on the calling thread
+void Instant(const char *name);
+
+// Names the calling thread in the exported trace
+void NameThread(const char *name);
+
+// Writes the events recorded since the last flush as a Chrome trace-event
+// JSON file, viewable in chrome://tracing or Perfetto
+bool Flush(const std::string &path);
+
+// Records the lifetime of the scope as a span. Names must be string literals,
+// they are stored as pointers and only read on flush.
+class Span {
+public:
+    explicit Span(const char *name) : Name(Enabled ? name : nullptr), Start(0) {
+        if (Name) {
+            Start = Profiler::Now();
+        }
+    }
+
+    ~Span() {
+        if (Name) {
+            Complete(Name, Start);
+        }
+    }
+
+    Span(const Span &) = delete;
+    Span &operator=(const Span &) = delete;
+
+private:
+    const char *Name;
+    long long Start;
+};
+
+} // namespace Trace
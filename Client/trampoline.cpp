@@ -0,0 +1,38 @@
+#include "trampoline.h"
+
+Hook::TrampolinePool::TrampolinePool(size_t slotSize, size_t blockSize, BlockAllocator allocate)
+	: slotSize(slotSize), blockSize(blockSize), allocate(allocate), used(blockSize) {}
+
+void *Hook::TrampolinePool::Allocate(size_t size) {
+	if (size > slotSize) {
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (used + slotSize > blockSize) {
+		const auto next = static_cast<uint8_t *>(allocate(blockSize));
+		if (!next) {
+			return nullptr;
+		}
+
+		// Blocks are never released, see Free
+		block = next;
+		used = 0;
+	}
+
+	const auto slot = block + used;
+	used += slotSize;
+	++allocated;
+
+	return slot;
+}
+
+void Hook::TrampolinePool::Free(void *slot) {
+	if (!slot) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	++retired;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace Hook {
+
+// Carves fixed-size trampoline slots out of large executable blocks. Platform
+// free, the blocks come from the allocator it's given, so the same code runs
+// on VirtualAlloc in the game and on mmap in the tests.
+//
+// Slots are never reused. A thread preempted inside a trampoline's copied
+// prologue may resume long after its hook was removed, so a freed slot keeps
+// its code and stays mapped for the lifetime of the process.
+class TrampolinePool {
+public:
+	// Returns an executable, writable block of size bytes, or nullptr
+	typedef void *(*BlockAllocator)(size_t size);
+
+	TrampolinePool(size_t slotSize, size_t blockSize, BlockAllocator allocate);
+
+	TrampolinePool(const TrampolinePool &) = delete;
+	TrampolinePool &operator=(const TrampolinePool &) = delete;
+
+	// Returns a slot of at least size bytes, or nullptr if size doesn't fit
+	// in a slot or no block could be allocated
+	void *Allocate(size_t size);
+
+	// Retires a slot. Its code is left as is and it's never handed out again
+	void Free(void *slot);
+
+	size_t GetSlotSize() const { return slotSize; }
+	size_t GetAllocated() const { return allocated; }
+	size_t GetRetired() const { return retired; }
+
+private:
+	const size_t slotSize;
+	const size_t blockSize;
+	const BlockAllocator allocate;
+
+	uint8_t *block = nullptr;
+	size_t used = 0;
+	size_t allocated = 0;
+	size_t retired = 0;
+	std::mutex mutex;
+};
+
+} // namespace Hook